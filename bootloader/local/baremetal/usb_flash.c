@@ -46,43 +46,52 @@ static Allocation storage_location = FLASH_INVALID;
 static FirmwareUploadState upload_state = UPLOAD_NOT_STARTED;
 static uint8_t storage_sav[STOR_FLASH_SECT_LEN];
 static uint8_t firmware_hash[SHA256_DIGEST_LENGTH];
+
+/* Upload staging buffer, programmed into flash a block at a time */
+static uint8_t upload_buf[UPLOAD_BUF_SIZE] __attribute__((aligned(4)));
+static uint32_t upload_buf_len;
+static uint32_t upload_buf_offset;
+
+/* Running hash of the image as it is received */
+static SHA256_CTX upload_ctx;
+static uint32_t upload_hash_end;
 extern bool reset_msg_stack;
 
 static const MessagesMap_t MessagesMap[] =
 {
     /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,              Initialize_fields,          (message_handler_t)(handler_initialize))
-    MSG_IN(MessageType_MessageType_Ping,                    Ping_fields,                (message_handler_t)(handler_ping))
-    MSG_IN(MessageType_MessageType_FirmwareErase,           FirmwareErase_fields,       (message_handler_t)(handler_erase))
-    MSG_IN(MessageType_MessageType_ButtonAck,               ButtonAck_fields,           NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_Cancel,                  Cancel_fields,              NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Initialize,              Initialize,                 (message_handler_t)(handler_initialize))
+    MSG_IN(MessageType_MessageType_Ping,                    Ping,                       (message_handler_t)(handler_ping))
+    MSG_IN(MessageType_MessageType_FirmwareErase,           FirmwareErase,              (message_handler_t)(handler_erase))
+    MSG_IN(MessageType_MessageType_ButtonAck,               ButtonAck,                  NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Cancel,                  Cancel,                     NO_PROCESS_FUNC)
 
     /* Normal Raw Messages */
-    RAW_IN(MessageType_MessageType_FirmwareUpload,          FirmwareUpload_fields,      (message_handler_t)(raw_handler_upload))
+    RAW_IN(MessageType_MessageType_FirmwareUpload,          FirmwareUpload,             (message_handler_t)(raw_handler_upload))
 
     /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Features,               Features_fields,            NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Success,                Success_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Failure,                Failure_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,          ButtonRequest_fields,       NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Features,               Features,                   NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Success,                Success,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Failure,                Failure,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_ButtonRequest,          ButtonRequest,              NO_PROCESS_FUNC)
 
 #if DEBUG_LINK
     /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision,     DebugLinkDecision_fields,   NO_PROCESS_FUNC)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState,     DebugLinkGetState_fields,   (message_handler_t)(handler_debug_link_get_state))
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,         DebugLinkStop_fields,       (message_handler_t)(handler_debug_link_stop))
-    DEBUG_IN(MessageType_MessageType_DebugLinkFillConfig,   DebugLinkFillConfig_fields, (message_handler_t)(handler_debug_link_fill_config))
+    DEBUG_IN(MessageType_MessageType_DebugLinkDecision,     DebugLinkDecision,          NO_PROCESS_FUNC)
+    DEBUG_IN(MessageType_MessageType_DebugLinkGetState,     DebugLinkGetState,          (message_handler_t)(handler_debug_link_get_state))
+    DEBUG_IN(MessageType_MessageType_DebugLinkStop,         DebugLinkStop,              (message_handler_t)(handler_debug_link_stop))
+    DEBUG_IN(MessageType_MessageType_DebugLinkFillConfig,   DebugLinkFillConfig, (message_handler_t)(handler_debug_link_fill_config))
 
     /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState,       DebugLinkState_fields,      NO_PROCESS_FUNC)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog,         DebugLinkLog_fields,        NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkState,       DebugLinkState,             NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkLog,         DebugLinkLog,               NO_PROCESS_FUNC)
 #endif
 };
 
 /* === Private Functions =================================================== */
 
 /*
- * check_firmware_hash - Checks flashed firmware's hash
+ * check_firmware_hash - Checks hash of received firmware
  *
  * INPUT
  *     none
@@ -92,11 +101,126 @@ static const MessagesMap_t MessagesMap[] =
  */
 static bool check_firmware_hash(void)
 {
-    uint8_t flashed_firmware_hash[SHA256_DIGEST_LENGTH];
+    uint8_t received_firmware_hash[SHA256_DIGEST_LENGTH];
+
+    /*
+     * Hash was accumulated during upload over the same range as
+     * memory_firmware_hash() and every block was verified against flash
+     * after programming, so flash does not need to be read back again
+     */
+    sha256_Final(received_firmware_hash, &upload_ctx);
+
+    return(memcmp(firmware_hash, received_firmware_hash, SHA256_DIGEST_LENGTH) == 0);
+}
+
+/*
+ * upload_init() - Reset upload staging buffer and start image hash
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+static void upload_init(void)
+{
+    upload_buf_len = 0;
+    upload_buf_offset = META_MAGIC_SIZE;
+    upload_hash_end = 0;
+
+    /* Magic is not programmed until the image is verified but is hashed */
+    sha256_Init(&upload_ctx);
+    sha256_Update(&upload_ctx, (const uint8_t *)META_MAGIC_STR, META_MAGIC_SIZE);
+}
+
+/*
+ * upload_flush() - Hash and program staged upload data into flash
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false status of flash write
+ *
+ */
+static bool upload_flush(void)
+{
+    bool ret_val = true;
+    uint32_t codelen, hash_len;
+
+    if(upload_buf_len == 0)
+    {
+        return(true);
+    }
+
+    /* Code length follows the magic so it always leads the first block */
+    if(upload_buf_offset == META_MAGIC_SIZE && upload_buf_len >= sizeof(codelen))
+    {
+        memcpy(&codelen, upload_buf, sizeof(codelen));
+
+        /* Oversized code length leaves the hash incomplete so the check fails */
+        upload_hash_end = (codelen <= FLASH_APP_LEN) ? FLASH_META_DESC_LEN + codelen : 0;
+    }
+
+    if(upload_buf_offset < upload_hash_end)
+    {
+        hash_len = upload_hash_end - upload_buf_offset;
+
+        if(hash_len > upload_buf_len)
+        {
+            hash_len = upload_buf_len;
+        }
+
+        sha256_Update(&upload_ctx, upload_buf, hash_len);
+    }
+
+    if(!flash_write_word(FLASH_APP, upload_buf_offset, upload_buf_len, upload_buf) ||
+            memcmp((void *)(flash_write_helper(FLASH_APP) + upload_buf_offset), upload_buf,
+                   upload_buf_len) != 0)
+    {
+        ret_val = false;
+    }
+
+    upload_buf_offset += upload_buf_len;
+    upload_buf_len = 0;
+
+    return(ret_val);
+}
+
+/*
+ * upload_write() - Stage upload data, programming flash as blocks fill up
+ *
+ * INPUT
+ *     - data: upload data
+ *     - len: length of upload data
+ * OUTPUT
+ *     true/false status of flash write
+ *
+ */
+static bool upload_write(const uint8_t *data, uint32_t len)
+{
+    uint32_t chunk;
 
-    memory_firmware_hash(flashed_firmware_hash);
+    while(len > 0)
+    {
+        chunk = UPLOAD_BUF_SIZE - upload_buf_len;
+
+        if(chunk > len)
+        {
+            chunk = len;
+        }
+
+        memcpy(upload_buf + upload_buf_len, data, chunk);
+        upload_buf_len += chunk;
+        data += chunk;
+        len -= chunk;
 
-    return(memcmp(firmware_hash, flashed_firmware_hash, SHA256_DIGEST_LENGTH) == 0);
+        if(upload_buf_len == UPLOAD_BUF_SIZE && !upload_flush())
+        {
+            return(false);
+        }
+    }
+
+    return(true);
 }
 
 /*
@@ -264,6 +388,9 @@ bool usb_flash_firmware(void)
     }
 
 uff_exit:
+    /* Nothing polls USB after this, make sure the last response is out */
+    usb_tx_flush();
+
     /* Clear the shadow before exiting */
     memset(storage_sav, 0, STOR_FLASH_SECT_LEN);
     return(ret_val);
@@ -510,6 +637,7 @@ void raw_handler_upload(uint8_t *msg, uint32_t msg_size, uint32_t frame_length)
                         msg_size -= META_MAGIC_SIZE;
                         msg = (uint8_t *)(msg + META_MAGIC_SIZE);
                         flash_offset = META_MAGIC_SIZE;
+                        upload_init();
                         /* Unlock the flash for writing */
                         flash_unlock();
                     }
@@ -524,8 +652,8 @@ void raw_handler_upload(uint8_t *msg, uint32_t msg_size, uint32_t frame_length)
 
                 }
 
-                /* Begin writing to flash */
-                if(!flash_write(FLASH_APP, flash_offset, msg_size, msg))
+                /* Stage data, flash is programmed a block at a time */
+                if(!upload_write(msg, msg_size))
                 {
                     /* Error: flash write error */
                     flash_lock();
@@ -551,6 +679,17 @@ void raw_handler_upload(uint8_t *msg, uint32_t msg_size, uint32_t frame_length)
             /* Finish firmware update */
             if(flash_offset >= frame_length - PROTOBUF_FIRMWARE_START)
             {
+                /* Program remaining partial block */
+                if(!upload_flush())
+                {
+                    flash_lock();
+                    send_failure(FailureType_Failure_FirmwareError,
+                                 "Encountered error while writing to flash");
+                    upload_state = UPLOAD_ERROR;
+                    dbg_print("Error: flash write error... \n\r");
+                    goto rhu_exit;
+                }
+
                 flash_lock();
                 upload_state = UPLOAD_COMPLETE;
             }
@@ -10,6 +10,7 @@ docker build -t $IMAGETAG .
 docker run -t -v $(pwd):/root/keepkey-firmware -v $(pwd)/$TEMPDIR:/root/$TEMPDIR --rm $IMAGETAG /bin/sh -c "\
 	cd /root/$TEMPDIR && \
 	cp /root/keepkey-firmware/interface/public/*.options . && \
+	cp /root/keepkey-firmware/interface/public/*.proto . && \
 	protoc -I. -I/usr/include --plugin=nanopb=protoc-gen-nanopb --nanopb_out=. *.proto && \
 	mv *.pb.c /root/keepkey-firmware/interface/local && \
 	mv *.pb.h /root/keepkey-firmware/interface/public"
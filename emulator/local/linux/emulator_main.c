@@ -0,0 +1,582 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host emulator for the message stack.  Packets from a recorded trace, or
+ * generated Ping requests, are fed through usb_rx_helper(), dispatch and
+ * msg_write() exactly as they would arrive from USB, and the time until each
+ * request is answered is reported per message type.
+ *
+ * Trace files hold one packet per line, "hid" or "bulk" followed by the
+ * packet in hex.  Lines starting with '#' are ignored.
+ */
+
+/* === Includes ============================================================ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include <nanopb.h>
+#include <interface.h>
+#include <msg_arena.h>
+#include <msg_dispatch.h>
+#include <usb_driver.h>
+#include <usb_host.h>
+
+/* === Defines ============================================================= */
+
+#define EMULATOR_MAX_MESSAGES   16      /* Distinct message types reported */
+#define EMULATOR_DEFAULT_COUNT  1000
+#define EMULATOR_LINE_MAX       256
+
+/* === Typedefs ============================================================ */
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t count;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint64_t total_ns;
+} EmulatorStats;
+
+/* === Private Variables =================================================== */
+
+static void emulator_msgInitialize(Initialize *msg);
+static void emulator_msgPing(Ping *msg);
+
+static const MessagesMap_t MessagesMap[] =
+{
+    /* Normal Messages */
+    MSG_IN(MessageType_MessageType_Initialize,          Initialize, (void (*)(void *))emulator_msgInitialize)
+    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures, (void (*)(void *))emulator_msgInitialize)
+    MSG_IN(MessageType_MessageType_Ping,                Ping, (void (*)(void *))emulator_msgPing)
+
+    /* Normal Out Messages */
+    MSG_OUT(MessageType_MessageType_Success,            Success,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Failure,            Failure,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Features,           Features,                   NO_PROCESS_FUNC)
+};
+
+static EmulatorStats stats[EMULATOR_MAX_MESSAGES];
+static uint32_t stats_count = 0;
+
+/* Request whose answer is outstanding */
+static bool frame_open = false;
+static uint32_t frame_id;
+static uint64_t frame_start;
+static uint32_t frame_replies;
+
+static uint32_t packets_in = 0, packets_out = 0;
+static FILE *trace_out = NULL;
+
+/* === Private Functions =================================================== */
+
+/*
+ * emulator_now() - Monotonic time
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     time in nanoseconds
+ */
+static uint64_t emulator_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+/*
+ * emulator_record() - Add a request latency sample
+ *
+ * INPUT
+ *     - id: message type of request
+ *     - ns: time until the request was answered
+ * OUTPUT
+ *     none
+ */
+static void emulator_record(uint32_t id, uint64_t ns)
+{
+    EmulatorStats *s = NULL;
+    uint32_t i;
+
+    for(i = 0; i < stats_count; i++)
+    {
+        if(stats[i].id == id)
+        {
+            s = &stats[i];
+            break;
+        }
+    }
+
+    if(s == NULL)
+    {
+        if(stats_count == EMULATOR_MAX_MESSAGES)
+        {
+            return;
+        }
+
+        s = &stats[stats_count++];
+        s->id = id;
+        s->min_ns = UINT64_MAX;
+    }
+
+    s->count++;
+    s->total_ns += ns;
+
+    if(ns < s->min_ns)
+    {
+        s->min_ns = ns;
+    }
+
+    if(ns > s->max_ns)
+    {
+        s->max_ns = ns;
+    }
+}
+
+/*
+ * emulator_failure() - Answer a request with a failure
+ *
+ * INPUT
+ *     - code: failure code
+ *     - text: failure message
+ * OUTPUT
+ *     none
+ */
+static void emulator_failure(FailureType code, const char *text)
+{
+    Failure *resp = (Failure *)msg_arena_response(sizeof(Failure));
+
+    memset(resp, 0, sizeof(Failure));
+    resp->has_code = true;
+    resp->code = code;
+
+    if(text)
+    {
+        resp->has_message = true;
+        snprintf(resp->message, sizeof(resp->message), "%s", text);
+    }
+
+    msg_write(MessageType_MessageType_Failure, resp);
+}
+
+/*
+ * emulator_msgInitialize() - Answer Initialize and GetFeatures
+ *
+ * INPUT
+ *     - msg: request
+ * OUTPUT
+ *     none
+ */
+static void emulator_msgInitialize(Initialize *msg)
+{
+    Features *resp = (Features *)msg_arena_response(sizeof(Features));
+
+    (void)msg;
+
+    memset(resp, 0, sizeof(Features));
+    resp->has_vendor = true;
+    snprintf(resp->vendor, sizeof(resp->vendor), "keepkey.com");
+    resp->has_major_version = true;
+    resp->major_version = MAJOR_VERSION;
+    resp->has_minor_version = true;
+    resp->minor_version = MINOR_VERSION;
+    resp->has_patch_version = true;
+    resp->patch_version = PATCH_VERSION;
+    resp->has_label = true;
+    snprintf(resp->label, sizeof(resp->label), "emulator");
+
+    msg_write(MessageType_MessageType_Features, resp);
+}
+
+/*
+ * emulator_msgPing() - Answer Ping, protection requests are confirmed
+ * automatically
+ *
+ * INPUT
+ *     - msg: request
+ * OUTPUT
+ *     none
+ */
+static void emulator_msgPing(Ping *msg)
+{
+    Success *resp = (Success *)msg_arena_response(sizeof(Success));
+
+    memset(resp, 0, sizeof(Success));
+
+    if(msg->has_message)
+    {
+        resp->has_message = true;
+        memcpy(resp->message, msg->message, sizeof(resp->message));
+    }
+
+    msg_write(MessageType_MessageType_Success, resp);
+}
+
+/*
+ * emulator_host_rx() - Count packets the device sends to the host
+ *
+ * INPUT
+ *     - iface: interface of packet
+ *     - packet: packet data
+ *     - len: length of packet
+ * OUTPUT
+ *     none
+ */
+static void emulator_host_rx(UsbInterface iface, const uint8_t *packet, uint32_t len)
+{
+    (void)iface;
+    (void)packet;
+    (void)len;
+
+    packets_out++;
+}
+
+/*
+ * emulator_send() - Send one packet to the device, timing the request it
+ * starts or completes
+ *
+ * INPUT
+ *     - iface: interface to send on
+ *     - packet: HID report, or bulk packet without report marker
+ *     - len: length of packet
+ * OUTPUT
+ *     none
+ */
+static void emulator_send(UsbInterface iface, const uint8_t *packet, uint32_t len)
+{
+    const uint8_t *header = packet + ((iface == USB_IFACE_BULK) ? 0 : 1);
+    uint32_t i;
+
+    if(trace_out)
+    {
+        fprintf(trace_out, "%s ", (iface == USB_IFACE_BULK) ? "bulk" : "hid");
+
+        for(i = 0; i < len; i++)
+        {
+            fprintf(trace_out, "%02x", packet[i]);
+        }
+
+        fprintf(trace_out, "\n");
+    }
+
+    /* First packet of a frame starts with "##" and the big endian message id */
+    if(!frame_open && len >= 5 && header[0] == '#' && header[1] == '#')
+    {
+        frame_open = true;
+        frame_id = (header[2] << 8) | header[3];
+        frame_replies = packets_out;
+        frame_start = emulator_now();
+    }
+
+    usb_host_write(iface, packet, len);
+    packets_in++;
+
+    /* Requests are answered while their last packet is handled */
+    if(frame_open && packets_out != frame_replies)
+    {
+        emulator_record(frame_id, emulator_now() - frame_start);
+        frame_open = false;
+    }
+}
+
+/*
+ * emulator_send_message() - Frame a message and send it to the device
+ *
+ * INPUT
+ *     - iface: interface to send on
+ *     - id: message type
+ *     - fields: protocol buffer fields of message
+ *     - msg: message
+ * OUTPUT
+ *     true/false whether message could be encoded
+ */
+static bool emulator_send_message(UsbInterface iface, MessageType id,
+                                  const pb_field_t *fields, const void *msg)
+{
+    static uint8_t frame[sizeof(TrezorFrameHeaderFirst) + MAX_FRAME_SIZE];
+    uint32_t marker = (iface == USB_IFACE_BULK) ? 0 : 1;
+    uint32_t len, pos;
+    pb_ostream_t os = pb_ostream_from_buffer(frame + sizeof(TrezorFrameHeaderFirst),
+                                             MAX_FRAME_SIZE);
+
+    if(!pb_encode(&os, fields, msg))
+    {
+        return(false);
+    }
+
+    len = os.bytes_written;
+    frame[0] = '#';
+    frame[1] = '#';
+    frame[2] = id >> 8;
+    frame[3] = id;
+    frame[4] = len >> 24;
+    frame[5] = len >> 16;
+    frame[6] = len >> 8;
+    frame[7] = len;
+    len += sizeof(TrezorFrameHeaderFirst);
+
+    /* HID reports lead with the '?' marker, bulk packets are all payload */
+    for(pos = 0; pos < len; pos += USB_SEGMENT_SIZE - marker)
+    {
+        uint8_t packet[USB_SEGMENT_SIZE] = { '?' };
+        uint32_t n = len - pos;
+
+        if(n > USB_SEGMENT_SIZE - marker)
+        {
+            n = USB_SEGMENT_SIZE - marker;
+        }
+
+        memcpy(packet + marker, frame + pos, n);
+        emulator_send(iface, packet, USB_SEGMENT_SIZE);
+    }
+
+    return(true);
+}
+
+/*
+ * emulator_replay() - Send the packets of a trace file
+ *
+ * INPUT
+ *     - path: trace file
+ * OUTPUT
+ *     true/false whether trace could be read
+ */
+static bool emulator_replay(const char *path)
+{
+    char line[EMULATOR_LINE_MAX];
+    FILE *f = fopen(path, "r");
+
+    if(f == NULL)
+    {
+        return(false);
+    }
+
+    while(fgets(line, sizeof(line), f))
+    {
+        uint8_t packet[USB_SEGMENT_SIZE];
+        UsbInterface iface;
+        const char *hex;
+        uint32_t len = 0;
+
+        if(strncmp(line, "hid ", 4) == 0)
+        {
+            iface = USB_IFACE_HID;
+            hex = line + 4;
+        }
+        else if(strncmp(line, "bulk ", 5) == 0)
+        {
+            iface = USB_IFACE_BULK;
+            hex = line + 5;
+        }
+        else
+        {
+            continue;
+        }
+
+        while(len < sizeof(packet) && sscanf(hex, "%2hhx", &packet[len]) == 1)
+        {
+            hex += 2;
+            len++;
+        }
+
+        emulator_send(iface, packet, len);
+    }
+
+    fclose(f);
+    return(true);
+}
+
+/*
+ * emulator_ping_sweep() - Send Ping requests with messages of growing size
+ *
+ * INPUT
+ *     - iface: interface to send on
+ *     - count: number of requests
+ *     - size: largest message size, messages cycle through 0 to size bytes
+ * OUTPUT
+ *     none
+ */
+static void emulator_ping_sweep(UsbInterface iface, uint32_t count, uint32_t size)
+{
+    static Ping ping;
+    uint32_t i;
+
+    emulator_send_message(iface, MessageType_MessageType_Initialize, Initialize_fields,
+                          &(Initialize){ 0 });
+
+    for(i = 0; i < count; i++)
+    {
+        uint32_t len = i % (size + 1);
+
+        memset(&ping, 0, sizeof(ping));
+        ping.has_message = true;
+        memset(ping.message, 'a' + i % 26, len);
+
+        emulator_send_message(iface, MessageType_MessageType_Ping, Ping_fields, &ping);
+    }
+}
+
+/*
+ * emulator_report() - Print latency per message type and resource use
+ *
+ * INPUT
+ *     - wall_ns: wall time of the run
+ *     - cpu: processor time of the run
+ * OUTPUT
+ *     none
+ */
+static void emulator_report(uint64_t wall_ns, clock_t cpu)
+{
+    uint32_t i, arena, response;
+    struct rusage usage;
+
+    printf("%8s %8s %10s %10s %10s\n", "msg id", "count", "min us", "avg us", "max us");
+
+    for(i = 0; i < stats_count; i++)
+    {
+        printf("%8u %8u %10.2f %10.2f %10.2f\n", stats[i].id, stats[i].count,
+               stats[i].min_ns / 1000.0, stats[i].total_ns / 1000.0 / stats[i].count,
+               stats[i].max_ns / 1000.0);
+    }
+
+    msg_arena_high_water(&arena, &response);
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("\npackets in %u, out %u\n", packets_in, packets_out);
+    printf("wall time %.3f ms, cpu time %.3f ms\n", wall_ns / 1e6,
+           cpu * 1000.0 / CLOCKS_PER_SEC);
+    printf("message arena high water %u bytes, response %u bytes\n", arena, response);
+    printf("peak resident set %ld kB\n", usage.ru_maxrss);
+}
+
+/*
+ * usage() - Print command line help
+ *
+ * INPUT
+ *     - name: program name
+ * OUTPUT
+ *     none
+ */
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-r trace] [-n count] [-s size] [-b] [-o trace]\n"
+            "  -r  replay packets from trace file\n"
+            "  -n  number of generated Ping requests (default %u)\n"
+            "  -s  largest generated Ping message (default 255)\n"
+            "  -b  send generated requests on the bulk interface\n"
+            "  -o  write sent packets to trace file\n",
+            name, EMULATOR_DEFAULT_COUNT);
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * main() - Application main entry
+ *
+ * INPUT
+ *     - argc: argument count
+ *     - argv: arguments
+ * OUTPUT
+ *     0 when successful
+ */
+int main(int argc, char *argv[])
+{
+    const char *replay = NULL;
+    uint32_t count = EMULATOR_DEFAULT_COUNT, size = sizeof(((Ping *)NULL)->message) - 1;
+    UsbInterface iface = USB_IFACE_HID;
+    uint64_t start;
+    clock_t cpu;
+    int opt;
+
+    while((opt = getopt(argc, argv, "r:n:s:bo:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'r':
+                replay = optarg;
+                break;
+
+            case 'n':
+                count = strtoul(optarg, NULL, 0);
+                break;
+
+            case 's':
+                size = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'b':
+                iface = USB_IFACE_BULK;
+                break;
+
+            case 'o':
+                trace_out = fopen(optarg, "w");
+                break;
+
+            default:
+                usage(argv[0]);
+                return(1);
+        }
+    }
+
+    if(size >= sizeof(((Ping *)NULL)->message))
+    {
+        size = sizeof(((Ping *)NULL)->message) - 1;
+    }
+
+    msg_map_init(MessagesMap, sizeof(MessagesMap) / sizeof(MessagesMap_t));
+    set_msg_failure_handler(&emulator_failure);
+    usb_host_set_rx_callback(&emulator_host_rx);
+    usb_init();
+    msg_init();
+
+    start = emulator_now();
+    cpu = clock();
+
+    if(replay)
+    {
+        if(!emulator_replay(replay))
+        {
+            fprintf(stderr, "cannot read %s\n", replay);
+            return(1);
+        }
+    }
+    else
+    {
+        emulator_ping_sweep(iface, count, size);
+    }
+
+    cpu = clock() - cpu;
+    emulator_report(emulator_now() - start, cpu);
+
+    if(trace_out)
+    {
+        fclose(trace_out);
+    }
+
+    return(0);
+}
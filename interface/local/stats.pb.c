@@ -0,0 +1,70 @@
+/* Automatically generated nanopb constant definitions */
+/* Generated by nanopb-0.2.9.2 at Fri Oct 16 18:27:04 2026. */
+
+#include "stats.pb.h"
+
+
+
+const pb_field_t MessageStatsType_fields[7] = {
+    PB_FIELD2(  1, UINT32  , OPTIONAL, STATIC  , FIRST, MessageStatsType, id, id, 0),
+    PB_FIELD2(  2, UINT32  , OPTIONAL, STATIC  , OTHER, MessageStatsType, count, id, 0),
+    PB_FIELD2(  3, UINT32  , OPTIONAL, STATIC  , OTHER, MessageStatsType, min_cycles, count, 0),
+    PB_FIELD2(  4, UINT32  , OPTIONAL, STATIC  , OTHER, MessageStatsType, max_cycles, min_cycles, 0),
+    PB_FIELD2(  5, UINT64  , OPTIONAL, STATIC  , OTHER, MessageStatsType, total_cycles, max_cycles, 0),
+    PB_FIELD2(  6, UINT32  , REPEATED, STATIC  , OTHER, MessageStatsType, histogram, total_cycles, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t FlashWriteStatsType_fields[7] = {
+    PB_FIELD2(  1, UINT32  , OPTIONAL, STATIC  , FIRST, FlashWriteStatsType, bytes, bytes, 0),
+    PB_FIELD2(  2, UINT32  , OPTIONAL, STATIC  , OTHER, FlashWriteStatsType, head, bytes, 0),
+    PB_FIELD2(  3, UINT32  , OPTIONAL, STATIC  , OTHER, FlashWriteStatsType, units, head, 0),
+    PB_FIELD2(  4, UINT32  , OPTIONAL, STATIC  , OTHER, FlashWriteStatsType, tail, units, 0),
+    PB_FIELD2(  5, UINT32  , OPTIONAL, STATIC  , OTHER, FlashWriteStatsType, unit_size, tail, 0),
+    PB_FIELD2(  6, UINT32  , OPTIONAL, STATIC  , OTHER, FlashWriteStatsType, cycles, unit_size, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t DebugLinkGetStats_fields[2] = {
+    PB_FIELD2(  1, BOOL    , OPTIONAL, STATIC  , FIRST, DebugLinkGetStats, reset, reset, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t DebugLinkStats_fields[10] = {
+    PB_FIELD2(  1, MESSAGE , REPEATED, STATIC  , FIRST, DebugLinkStats, messages, messages, &MessageStatsType_fields),
+    PB_FIELD2(  2, MESSAGE , REPEATED, STATIC  , OTHER, DebugLinkStats, phases, messages, &MessageStatsType_fields),
+    PB_FIELD2(  3, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, cycles_per_us, phases, 0),
+    PB_FIELD2(  4, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, arena_high_water, cycles_per_us, 0),
+    PB_FIELD2(  5, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, response_high_water, arena_high_water, 0),
+    PB_FIELD2(  6, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, usb_tx_packets, response_high_water, 0),
+    PB_FIELD2(  7, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, usb_tx_high_water, usb_tx_packets, 0),
+    PB_FIELD2(  8, UINT32  , OPTIONAL, STATIC  , OTHER, DebugLinkStats, usb_tx_full_waits, usb_tx_high_water, 0),
+    PB_FIELD2(  9, MESSAGE , OPTIONAL, STATIC  , OTHER, DebugLinkStats, flash_write, usb_tx_full_waits, &FlashWriteStatsType_fields),
+    PB_LAST_FIELD
+};
+
+
+/* Check that field information fits in pb_field_t */
+#if !defined(PB_FIELD_32BIT)
+/* If you get an error here, it means that you need to define PB_FIELD_32BIT
+ * compile-time option. You can do that in pb.h or on compiler command line.
+ * 
+ * The reason you need to do this is that some of your messages contain tag
+ * numbers or field sizes that are larger than what can fit in 8 or 16 bit
+ * field descriptors.
+ */
+STATIC_ASSERT((pb_membersize(DebugLinkStats, messages[0]) < 65536 && pb_membersize(DebugLinkStats, phases[0]) < 65536 && pb_membersize(DebugLinkStats, flash_write) < 65536), YOU_MUST_DEFINE_PB_FIELD_32BIT_FOR_MESSAGES_MessageStatsType_FlashWriteStatsType_DebugLinkGetStats_DebugLinkStats)
+#endif
+
+#if !defined(PB_FIELD_16BIT) && !defined(PB_FIELD_32BIT)
+/* If you get an error here, it means that you need to define PB_FIELD_16BIT
+ * compile-time option. You can do that in pb.h or on compiler command line.
+ * 
+ * The reason you need to do this is that some of your messages contain tag
+ * numbers or field sizes that are larger than what can fit in the default
+ * 8 bit descriptors.
+ */
+STATIC_ASSERT((pb_membersize(DebugLinkStats, messages[0]) < 256 && pb_membersize(DebugLinkStats, phases[0]) < 256 && pb_membersize(DebugLinkStats, flash_write) < 256), YOU_MUST_DEFINE_PB_FIELD_16BIT_FOR_MESSAGES_MessageStatsType_FlashWriteStatsType_DebugLinkGetStats_DebugLinkStats)
+#endif
+
+
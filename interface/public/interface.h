@@ -22,12 +22,13 @@
 
 #include "messages.pb.h"
 #include "storage.pb.h"
+#include "stats.pb.h"
 #include "types.pb.h"
 #include "trezor_transport.h"
 
 /* === Defines ============================================================= */
 
-/* The max size of a decoded protobuf */
-#define MAX_DECODE_SIZE (12 * 1024)
+/* The max size of a decoded protobuf (TxAck is the largest) */
+#define MAX_DECODE_SIZE (11 * 1024)
 
 #endif
@@ -0,0 +1,129 @@
+/* Automatically generated nanopb header */
+/* Generated by nanopb-0.2.9.2 at Fri Oct 16 18:27:04 2026. */
+
+#ifndef _PB_STATS_PB_H_
+#define _PB_STATS_PB_H_
+#include <pb.h>
+
+#include "types.pb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enum definitions */
+typedef enum _StatsMessageType {
+    StatsMessageType_MessageType_DebugLinkGetStats = 200,
+    StatsMessageType_MessageType_DebugLinkStats = 201
+} StatsMessageType;
+
+/* Struct definitions */
+typedef struct _MessageStatsType {
+    bool has_id;
+    uint32_t id;
+    bool has_count;
+    uint32_t count;
+    bool has_min_cycles;
+    uint32_t min_cycles;
+    bool has_max_cycles;
+    uint32_t max_cycles;
+    bool has_total_cycles;
+    uint64_t total_cycles;
+    size_t histogram_count;
+    uint32_t histogram[8];
+} MessageStatsType;
+
+typedef struct _FlashWriteStatsType {
+    bool has_bytes;
+    uint32_t bytes;
+    bool has_head;
+    uint32_t head;
+    bool has_units;
+    uint32_t units;
+    bool has_tail;
+    uint32_t tail;
+    bool has_unit_size;
+    uint32_t unit_size;
+    bool has_cycles;
+    uint32_t cycles;
+} FlashWriteStatsType;
+
+typedef struct _DebugLinkGetStats {
+    bool has_reset;
+    bool reset;
+} DebugLinkGetStats;
+
+typedef struct _DebugLinkStats {
+    size_t messages_count;
+    MessageStatsType messages[16];
+    size_t phases_count;
+    MessageStatsType phases[8];
+    bool has_cycles_per_us;
+    uint32_t cycles_per_us;
+    bool has_arena_high_water;
+    uint32_t arena_high_water;
+    bool has_response_high_water;
+    uint32_t response_high_water;
+    bool has_usb_tx_packets;
+    uint32_t usb_tx_packets;
+    bool has_usb_tx_high_water;
+    uint32_t usb_tx_high_water;
+    bool has_usb_tx_full_waits;
+    uint32_t usb_tx_full_waits;
+    bool has_flash_write;
+    FlashWriteStatsType flash_write;
+} DebugLinkStats;
+
+/* Default values for struct fields */
+
+/* Initializer values for message structs */
+#define MessageStatsType_init_default            {false, 0, false, 0, false, 0, false, 0, false, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define FlashWriteStatsType_init_default         {false, 0, false, 0, false, 0, false, 0, false, 0, false, 0}
+#define DebugLinkGetStats_init_default           {false, 0}
+#define DebugLinkStats_init_default              {0, {MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default}, 0, {MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default, MessageStatsType_init_default}, false, 0, false, 0, false, 0, false, 0, false, 0, false, 0, false, FlashWriteStatsType_init_default}
+#define MessageStatsType_init_zero               {false, 0, false, 0, false, 0, false, 0, false, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define FlashWriteStatsType_init_zero            {false, 0, false, 0, false, 0, false, 0, false, 0, false, 0}
+#define DebugLinkGetStats_init_zero              {false, 0}
+#define DebugLinkStats_init_zero                 {0, {MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero}, 0, {MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero, MessageStatsType_init_zero}, false, 0, false, 0, false, 0, false, 0, false, 0, false, 0, false, FlashWriteStatsType_init_zero}
+
+/* Field tags (for use in manual encoding/decoding) */
+#define DebugLinkGetStats_reset_tag              1
+#define DebugLinkStats_messages_tag              1
+#define DebugLinkStats_phases_tag                2
+#define DebugLinkStats_cycles_per_us_tag         3
+#define DebugLinkStats_arena_high_water_tag      4
+#define DebugLinkStats_response_high_water_tag   5
+#define DebugLinkStats_usb_tx_packets_tag        6
+#define DebugLinkStats_usb_tx_high_water_tag     7
+#define DebugLinkStats_usb_tx_full_waits_tag     8
+#define DebugLinkStats_flash_write_tag           9
+#define FlashWriteStatsType_bytes_tag            1
+#define FlashWriteStatsType_head_tag             2
+#define FlashWriteStatsType_units_tag            3
+#define FlashWriteStatsType_tail_tag             4
+#define FlashWriteStatsType_unit_size_tag        5
+#define FlashWriteStatsType_cycles_tag           6
+#define MessageStatsType_id_tag                  1
+#define MessageStatsType_count_tag               2
+#define MessageStatsType_min_cycles_tag          3
+#define MessageStatsType_max_cycles_tag          4
+#define MessageStatsType_total_cycles_tag        5
+#define MessageStatsType_histogram_tag           6
+
+/* Struct field encoding specification for nanopb */
+extern const pb_field_t MessageStatsType_fields[7];
+extern const pb_field_t FlashWriteStatsType_fields[7];
+extern const pb_field_t DebugLinkGetStats_fields[2];
+extern const pb_field_t DebugLinkStats_fields[10];
+
+/* Maximum encoded size of messages (where known) */
+#define MessageStatsType_size                    83
+#define FlashWriteStatsType_size                 36
+#define DebugLinkGetStats_size                   2
+#define DebugLinkStats_size                      2114
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -37,6 +37,24 @@
 
 /* === Private Functions =================================================== */
 
+/*
+ * qr_module_dark() - Get color of a module in an encoded QR code
+ *
+ * INPUT
+ *     - bitdata: QR code from qr_encode()
+ *     - side: QR code size in modules
+ *     - x: module column
+ *     - y: module row
+ * OUTPUT
+ *     true/false whether module is dark
+ */
+static bool qr_module_dark(const unsigned char *bitdata, int side, int x, int y)
+{
+    int a = y * side + x;
+
+    return((bitdata[a / 8] & (1 << (7 - a % 8))) != 0);
+}
+
 /*
  * layout_animate_pin() - Animate pin scramble
  *
@@ -574,17 +592,34 @@ void layout_cipher(const char *current_word, const char *cipher)
 void layout_address(const char *address)
 {
     static unsigned char bitdata[QR_MAX_BITDATA];
+    static char cached_address[QR_CACHE_ADDRESS_LEN] = "";
+    static int side = -1;
     Canvas *canvas = layout_get_canvas();
 
-    int a, i, j, side;
+    int i, j, run;
+    size_t address_len = strlen(address);
 
-    if(strlen(address) <= BTC_ADDRESS_SIZE)
-    {
-        side = qr_encode(QR_LEVEL_M, 0, address, 0, bitdata);
-    }
-    else
+    /* Switching back to the QR view of the same address reuses the last encoding */
+    if(address_len >= sizeof(cached_address) || strcmp(cached_address, address) != 0)
     {
-        side = qr_encode(QR_LEVEL_M, 8, address, 0, bitdata);
+        if(address_len <= BTC_ADDRESS_SIZE)
+        {
+            side = qr_encode(QR_LEVEL_M, 0, address, 0, bitdata);
+        }
+        else
+        {
+            side = qr_encode(QR_LEVEL_M, 8, address, 0, bitdata);
+        }
+
+        /* Only cache addresses that fit, a truncated copy could match another one */
+        if(address_len < sizeof(cached_address))
+        {
+            strlcpy(cached_address, address, sizeof(cached_address));
+        }
+        else
+        {
+            cached_address[0] = '\0';
+        }
     }
 
     /* Limit QR to version 1-9 (QR size <= 53) */
@@ -594,20 +629,31 @@ void layout_address(const char *address)
         draw_box_simple(canvas, 0xFF, QR_DISPLAY_X, QR_DISPLAY_Y,
                         (side + 2) * QR_DISPLAY_SCALE, (side + 2) * QR_DISPLAY_SCALE);
 
-        /* Fill in QR */
-        for(i = 0; i < side; i++)
+        /* Fill in QR a run of dark modules at a time */
+        for(j = 0; j < side; j++)
         {
-            for(j = 0; j < side; j++)
+            i = 0;
+
+            while(i < side)
             {
-                a = j * side + i;
+                if(!qr_module_dark(bitdata, side, i, j))
+                {
+                    i++;
+                    continue;
+                }
+
+                run = 1;
 
-                if(bitdata[a / 8] & (1 << (7 - a % 8)))
+                while(i + run < side && qr_module_dark(bitdata, side, i + run, j))
                 {
-                    draw_box_simple(canvas, 0x00,
-                                    QR_DISPLAY_SCALE + (i + QR_DISPLAY_X) * QR_DISPLAY_SCALE,
-                                    QR_DISPLAY_SCALE + (j + QR_DISPLAY_Y) * QR_DISPLAY_SCALE,
-                                    QR_DISPLAY_SCALE, QR_DISPLAY_SCALE);
+                    run++;
                 }
+
+                draw_box_simple(canvas, 0x00,
+                                QR_DISPLAY_SCALE + (i + QR_DISPLAY_X) * QR_DISPLAY_SCALE,
+                                QR_DISPLAY_SCALE + (j + QR_DISPLAY_Y) * QR_DISPLAY_SCALE,
+                                run * QR_DISPLAY_SCALE, QR_DISPLAY_SCALE);
+                i += run;
             }
         }
     }
@@ -19,7 +19,6 @@
 
 /* === Includes ============================================================ */
 
-#include <string.h>
 #include <stdint.h>
 
 #include <resources.h>
@@ -30,175 +29,107 @@
 
 /* --- Screensaver --------------------------------------------------------- */
 
-static void screensaver_1(uint8_t *data)
-{
-    const uint8_t image_data[1357] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x05, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x03, 0x00, 0xf9, 0x25, 0x31, 0x2e, 0x0d, 0x03, 0x1c, 0x2c, 0x02, 0x31, 0xfd, 0x25, 0x19, 0x01, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2e, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xf9, 0x07, 0x31, 0x33, 0x31, 0x03, 0x00, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xfd, 0x14, 0x00, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x14, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0b, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0d, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x02, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x03, 0x1c, 0x2c, 0x33, 0x31, 0x25, 0x19, 0x03, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfd, 0x25, 0x01, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x07, 0x04, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x14, 0x03, 0x00, 0xfe, 0x01, 0x25, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x31, 0x02, 0x1e, 0xfe, 0x25, 0x2c, 0x04, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x01, 0x29, 0x06, 0x33, 0xff, 0x1e, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf8, 0x03, 0x1e, 0x2e, 0x33, 0x2e, 0x25, 0x14, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_1_image = {(void *) &screensaver_1, 256, 64};
-
-static void screensaver_2(uint8_t *data)
-{
-    const uint8_t image_data[1354] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x05, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x03, 0x00, 0xf4, 0x37, 0x4a, 0x46, 0x1c, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x02, 0x00, 0x03, 0x4d, 0x02, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xff, 0x46, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xf9, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x00, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xfd, 0x1c, 0x00, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xfd, 0x2a, 0x00, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0b, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x02, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0x03, 0x4d, 0xff, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x04, 0x00, 0x03, 0x4d, 0xf8, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfd, 0x3e, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x08, 0x04, 0x00, 0xff, 0x04, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x02, 0x37, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x4a, 0x02, 0x2e, 0xfe, 0x32, 0x46, 0x04, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x02, 0x3e, 0x06, 0x4d, 0xff, 0x2e, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf8, 0x08, 0x2e, 0x46, 0x4d, 0x46, 0x3e, 0x1c, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_2_image = {(void *) &screensaver_2, 256, 64};
-
-static void screensaver_3(uint8_t *data)
-{
-    const uint8_t image_data[1363] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x05, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x03, 0x00, 0xf4, 0x47, 0x61, 0x5d, 0x23, 0x06, 0x39, 0x5a, 0x64, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x02, 0x00, 0x03, 0x66, 0x02, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xf9, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x00, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xfd, 0x23, 0x00, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xfd, 0x39, 0x00, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x47, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x41, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0a, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x02, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x0b, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0x03, 0x66, 0xff, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x06, 0x39, 0x5a, 0x66, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfd, 0x52, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x06, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x23, 0x03, 0x00, 0xfe, 0x02, 0x47, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x61, 0x02, 0x41, 0xfe, 0x47, 0x5a, 0x04, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x02, 0x52, 0x06, 0x66, 0xff, 0x39, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf8, 0x0b, 0x41, 0x5d, 0x64, 0x5d, 0x52, 0x23, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_3_image = {(void *) &screensaver_3, 256, 64};
-
-static void screensaver_4(uint8_t *data)
-{
-    const uint8_t image_data[1360] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00, 0xfc, 0x5a, 0x7a, 0x72, 0x2b, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x72, 0x02, 0x80, 0xff, 0x7d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x05, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x03, 0x00, 0xf4, 0x5a, 0x7a, 0x72, 0x2b, 0x07, 0x47, 0x6e, 0x7d, 0x76, 0x66, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfe, 0x66, 0x07, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfe, 0x66, 0x07, 0x02, 0x00, 0x03, 0x80, 0x02, 0x6e, 0x06, 0x80, 0xfe, 0x6e, 0x14, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0xff, 0x72, 0x0b, 0x80, 0xff, 0x5a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xf9, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x00, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xfb, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x02, 0x00, 0x03, 0x80, 0xfa, 0x51, 0x14, 0x07, 0x02, 0x14, 0x6e, 0x02, 0x80, 0xff, 0x7a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xfd, 0x2b, 0x00, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x2b, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x2b, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xfd, 0x47, 0x00, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xfe, 0x5a, 0x00, 0x0c, 0x80, 0xff, 0x5a, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x02, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xfe, 0x51, 0x00, 0x0c, 0x80, 0xff, 0x51, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x02, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x47, 0x03, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0b, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0c, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0b, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x2b, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x02, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x03, 0x00, 0x03, 0x80, 0xfa, 0x51, 0x14, 0x07, 0x02, 0x14, 0x6e, 0x02, 0x80, 0xff, 0x7a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0x0b, 0x80, 0xff, 0x5a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x06, 0x80, 0xfe, 0x6e, 0x14, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x05, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x04, 0x00, 0x03, 0x80, 0xf8, 0x07, 0x47, 0x6e, 0x80, 0x76, 0x66, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x02, 0x00, 0x05, 0x80, 0x04, 0x00, 0x05, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfd, 0x66, 0x07, 0x00, 0x05, 0x80, 0x04, 0x00, 0x05, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xfb, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x2b, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xff, 0x5a, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xff, 0x51, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x47, 0x03, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0c, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x76, 0x02, 0x80, 0xff, 0x14, 0x04, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x03, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xfe, 0x02, 0x5a, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x7a, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x04, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x06, 0x80, 0xff, 0x51, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x05, 0x00, 0xf8, 0x07, 0x51, 0x72, 0x80, 0x76, 0x66, 0x2b, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x72, 0x02, 0x80, 0xff, 0x7d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x5a, 0x7a, 0x76, 0x2b, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_4_image = {(void *) &screensaver_4, 256, 64};
-
-static void screensaver_5(uint8_t *data)
-{
-    const uint8_t image_data[1353] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x05, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x03, 0x00, 0xf4, 0x6c, 0x94, 0x8b, 0x30, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x02, 0x00, 0x03, 0x99, 0x02, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x02, 0x00, 0xff, 0x8b, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xf9, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x00, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xfd, 0x44, 0x00, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfd, 0x50, 0x00, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x6c, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x62, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0b, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0a, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x02, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0x03, 0x99, 0xff, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfd, 0x7a, 0x08, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x08, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfb, 0x94, 0x62, 0x59, 0x6c, 0x8b, 0x04, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x03, 0x84, 0x06, 0x99, 0xff, 0x59, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf8, 0x0e, 0x62, 0x8b, 0x99, 0x8b, 0x7a, 0x44, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_5_image = {(void *) &screensaver_5, 256, 64};
-
-static void screensaver_6(uint8_t *data)
-{
-    const uint8_t image_data[1357] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x5b, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x05, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x03, 0x00, 0xf4, 0x79, 0xaa, 0xa4, 0x37, 0x09, 0x62, 0x94, 0xb0, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x02, 0x94, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xff, 0xa4, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xf9, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x00, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xfd, 0x4f, 0x00, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xfd, 0x62, 0x00, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0b, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0a, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x02, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0x03, 0xb3, 0xff, 0x9e, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x04, 0x00, 0x03, 0xb3, 0xf8, 0x09, 0x62, 0x9e, 0xb3, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x02, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfd, 0x84, 0x09, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x09, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x4f, 0x03, 0x00, 0xfe, 0x03, 0x79, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0xaa, 0x02, 0x70, 0xfe, 0x79, 0x9e, 0x04, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x03, 0x94, 0x06, 0xb3, 0xff, 0x70, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf8, 0x09, 0x70, 0xa4, 0xb3, 0xa4, 0x84, 0x4f, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x20, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_6_image = {(void *) &screensaver_6, 256, 64};
-
-static void screensaver_7(uint8_t *data)
-{
-    const uint8_t image_data[1372] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x64, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x05, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x03, 0x00, 0xf4, 0x8b, 0xc2, 0xbb, 0x40, 0x0a, 0x72, 0xad, 0xc8, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x08, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xf9, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x00, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xfd, 0x40, 0x00, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xfd, 0x72, 0x00, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0b, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x02, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x0b, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x04, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x72, 0xb4, 0xcc, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfd, 0x9b, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x03, 0x05, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xfe, 0x03, 0x8b, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0xc2, 0x02, 0x80, 0xfe, 0x8b, 0xb4, 0x04, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x06, 0xcc, 0xff, 0x80, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf8, 0x0a, 0x80, 0xbb, 0xc8, 0xbb, 0x9b, 0x5f, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x17, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_7_image = {(void *) &screensaver_7, 256, 64};
-
-static void screensaver_8(uint8_t *data)
-{
-    const uint8_t image_data[1365] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x6e, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x05, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x03, 0x00, 0xf4, 0x9c, 0xdb, 0xd2, 0x48, 0x0b, 0x80, 0xbe, 0xe2, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfe, 0xbe, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x08, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xf9, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x00, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xfd, 0x48, 0x00, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xfd, 0x80, 0x00, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0b, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x02, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x0b, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0x03, 0xe6, 0xff, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x04, 0x00, 0x03, 0xe6, 0xf8, 0x0b, 0x80, 0xcb, 0xe6, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x02, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfd, 0xaa, 0x0b, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x21, 0x04, 0x00, 0xff, 0x0b, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xfe, 0x04, 0x9c, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0xdb, 0x02, 0x91, 0xfe, 0x9c, 0xcb, 0x04, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x0b, 0xbe, 0x06, 0xe6, 0xff, 0x91, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf8, 0x0b, 0x91, 0xd2, 0xe2, 0xd2, 0xaa, 0x6b, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x0d, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_8_image = {(void *) &screensaver_8, 256, 64};
-
-static void screensaver_9(uint8_t *data)
-{
-    const uint8_t image_data[1365] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x78, 0x00, 0xfc, 0xac, 0xf2, 0xe9, 0x4e, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xff, 0xff, 0xd3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0xfb, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x05, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x03, 0x00, 0xf4, 0xac, 0xf2, 0xe9, 0x4e, 0x0d, 0x8c, 0xd3, 0xfb, 0xf2, 0xbd, 0x71, 0x0d, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfe, 0xbd, 0x0d, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfe, 0xbd, 0x0d, 0x02, 0x00, 0x03, 0xff, 0xfe, 0xd3, 0xe1, 0x06, 0xff, 0xfe, 0xe1, 0x24, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0xfb, 0x08, 0xff, 0xff, 0xac, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xf9, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x00, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xfb, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x02, 0x00, 0x03, 0xff, 0xfa, 0xac, 0x4e, 0x0d, 0x04, 0x24, 0xd3, 0x02, 0xff, 0xff, 0xf2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xfd, 0x71, 0x00, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xff, 0x71, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x4e, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xfd, 0x8c, 0x00, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x24, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xac, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x04, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xac, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x04, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8c, 0x03, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0b, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x24, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0a, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0b, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x4e, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x02, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x03, 0x00, 0x03, 0xff, 0xfa, 0xac, 0x4e, 0x0d, 0x04, 0x24, 0xd3, 0x02, 0xff, 0xff, 0xf2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x0b, 0xff, 0xff, 0xac, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0x03, 0xff, 0xff, 0xe1, 0x06, 0xff, 0xfe, 0xe1, 0x24, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x05, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x04, 0x00, 0x03, 0xff, 0xf8, 0x0d, 0x8c, 0xe1, 0xff, 0xf2, 0xbd, 0x71, 0x0d, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x02, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfd, 0xbd, 0x0d, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xfb, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xff, 0x71, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8c, 0x03, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0c, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0b, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x24, 0x04, 0x00, 0xff, 0x0d, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x03, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x71, 0x03, 0x00, 0xfe, 0x04, 0xac, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0xf2, 0x02, 0xa0, 0xfe, 0xac, 0xe1, 0x04, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0xfe, 0x0d, 0xd3, 0x06, 0xff, 0xff, 0xa0, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x05, 0x00, 0xf8, 0x0d, 0xa0, 0xe9, 0xfb, 0xe9, 0xbd, 0x71, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0xfb, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xff, 0xff, 0xd3, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0xac, 0xf2, 0xe9, 0x4e, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x03, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_9_image = {(void *) &screensaver_9, 256, 64};
-
-static void screensaver_10(uint8_t *data)
-{
-    const uint8_t image_data[1365] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x03, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x05, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x03, 0x00, 0xf4, 0x9c, 0xdb, 0xd2, 0x48, 0x0b, 0x80, 0xbe, 0xe2, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfe, 0xbe, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x08, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xf9, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x00, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xfd, 0x48, 0x00, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xfd, 0x80, 0x00, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0b, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x02, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x0b, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0x03, 0xe6, 0xff, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x04, 0x00, 0x03, 0xe6, 0xf8, 0x0b, 0x80, 0xcb, 0xe6, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x02, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfd, 0xaa, 0x0b, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x21, 0x04, 0x00, 0xff, 0x0b, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xfe, 0x04, 0x9c, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0xdb, 0x02, 0x91, 0xfe, 0x9c, 0xcb, 0x04, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x0b, 0xbe, 0x06, 0xe6, 0xff, 0x91, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf8, 0x0b, 0x91, 0xd2, 0xe2, 0xd2, 0xaa, 0x6b, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x78, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_10_image = {(void *) &screensaver_10, 256, 64};
-
-static void screensaver_11(uint8_t *data)
-{
-    const uint8_t image_data[1372] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x0c, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x05, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x03, 0x00, 0xf4, 0x8b, 0xc2, 0xbb, 0x40, 0x0a, 0x72, 0xad, 0xc8, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x08, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xf9, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x00, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xfd, 0x40, 0x00, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xfd, 0x72, 0x00, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0b, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x02, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x0b, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x04, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x72, 0xb4, 0xcc, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfd, 0x9b, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x03, 0x05, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xfe, 0x03, 0x8b, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0xc2, 0x02, 0x80, 0xfe, 0x8b, 0xb4, 0x04, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x06, 0xcc, 0xff, 0x80, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf8, 0x0a, 0x80, 0xbb, 0xc8, 0xbb, 0x9b, 0x5f, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x6f, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_11_image = {(void *) &screensaver_11, 256, 64};
-
-static void screensaver_12(uint8_t *data)
-{
-    const uint8_t image_data[1357] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x16, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x05, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x03, 0x00, 0xf4, 0x79, 0xaa, 0xa4, 0x37, 0x09, 0x62, 0x94, 0xb0, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x02, 0x94, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xff, 0xa4, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xf9, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x00, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xfd, 0x4f, 0x00, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xfd, 0x62, 0x00, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0b, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0a, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x02, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0x03, 0xb3, 0xff, 0x9e, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x04, 0x00, 0x03, 0xb3, 0xf8, 0x09, 0x62, 0x9e, 0xb3, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x02, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfd, 0x84, 0x09, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x09, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x4f, 0x03, 0x00, 0xfe, 0x03, 0x79, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0xaa, 0x02, 0x70, 0xfe, 0x79, 0x9e, 0x04, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x03, 0x94, 0x06, 0xb3, 0xff, 0x70, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf8, 0x09, 0x70, 0xa4, 0xb3, 0xa4, 0x84, 0x4f, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x65, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_12_image = {(void *) &screensaver_12, 256, 64};
-
-static void screensaver_13(uint8_t *data)
-{
-    const uint8_t image_data[1353] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x20, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x05, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x03, 0x00, 0xf4, 0x6c, 0x94, 0x8b, 0x30, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x02, 0x00, 0x03, 0x99, 0x02, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x02, 0x00, 0xff, 0x8b, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xf9, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x00, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xfd, 0x44, 0x00, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfd, 0x50, 0x00, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x6c, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x62, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0b, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0a, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x02, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0x03, 0x99, 0xff, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfd, 0x7a, 0x08, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x08, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfb, 0x94, 0x62, 0x59, 0x6c, 0x8b, 0x04, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x03, 0x84, 0x06, 0x99, 0xff, 0x59, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf8, 0x0e, 0x62, 0x8b, 0x99, 0x8b, 0x7a, 0x44, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x5b, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_13_image = {(void *) &screensaver_13, 256, 64};
-
-static void screensaver_14(uint8_t *data)
-{
-    const uint8_t image_data[1362] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00, 0xfc, 0x57, 0x78, 0x74, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x70, 0x02, 0x7f, 0xff, 0x7c, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x05, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x03, 0x00, 0xf4, 0x57, 0x78, 0x74, 0x2c, 0x07, 0x47, 0x6c, 0x7f, 0x78, 0x60, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfe, 0x60, 0x03, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfe, 0x60, 0x03, 0x02, 0x00, 0x03, 0x7f, 0x02, 0x6c, 0x06, 0x7f, 0xfe, 0x6c, 0x15, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0xff, 0x70, 0x0b, 0x7f, 0xff, 0x57, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xf9, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x00, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xfb, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x02, 0x00, 0x03, 0x7f, 0xfe, 0x51, 0x15, 0x02, 0x03, 0xfe, 0x15, 0x6c, 0x02, 0x7f, 0xff, 0x78, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xfd, 0x2c, 0x00, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xff, 0x2c, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x2c, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xfd, 0x47, 0x00, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xfe, 0x57, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x03, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xfe, 0x57, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x03, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0xfe, 0x00, 0x47, 0x03, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0b, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0c, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0b, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x2c, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x02, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x03, 0x00, 0x03, 0x7f, 0xfe, 0x51, 0x15, 0x02, 0x03, 0xfe, 0x15, 0x6c, 0x02, 0x7f, 0xff, 0x78, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0x0b, 0x7f, 0xff, 0x57, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x06, 0x7f, 0xfe, 0x70, 0x15, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x05, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x04, 0x00, 0x03, 0x7f, 0xf8, 0x07, 0x47, 0x70, 0x7f, 0x78, 0x60, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x02, 0x00, 0x05, 0x7f, 0x04, 0x00, 0x05, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfd, 0x60, 0x03, 0x00, 0x05, 0x7f, 0x04, 0x00, 0x05, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xfb, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xff, 0x2c, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0xfe, 0x00, 0x47, 0x03, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0c, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x15, 0x04, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x03, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x2c, 0x03, 0x00, 0xfe, 0x03, 0x57, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x78, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x04, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x06, 0x7f, 0xff, 0x51, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x05, 0x00, 0xf8, 0x07, 0x51, 0x74, 0x7f, 0x74, 0x60, 0x2c, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x70, 0x02, 0x7f, 0xff, 0x7c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x57, 0x78, 0x74, 0x2c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_14_image = {(void *) &screensaver_14, 256, 64};
-
-static void screensaver_15(uint8_t *data)
-{
-    const uint8_t image_data[1363] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x05, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x03, 0x00, 0xf4, 0x47, 0x61, 0x5d, 0x23, 0x06, 0x39, 0x5a, 0x64, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x02, 0x00, 0x03, 0x66, 0x02, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xf9, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x00, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xfd, 0x23, 0x00, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xfd, 0x39, 0x00, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x47, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x41, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0a, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x02, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x0b, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0x03, 0x66, 0xff, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x06, 0x39, 0x5a, 0x66, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfd, 0x52, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x06, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x23, 0x03, 0x00, 0xfe, 0x02, 0x47, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x61, 0x02, 0x41, 0xfe, 0x47, 0x5a, 0x04, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x02, 0x52, 0x06, 0x66, 0xff, 0x39, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf8, 0x0b, 0x41, 0x5d, 0x64, 0x5d, 0x52, 0x23, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_15_image = {(void *) &screensaver_15, 256, 64};
-
-static void screensaver_16(uint8_t *data)
-{
-    const uint8_t image_data[1354] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x05, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x03, 0x00, 0xf4, 0x37, 0x4a, 0x46, 0x1c, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x02, 0x00, 0x03, 0x4d, 0x02, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xff, 0x46, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xf9, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x00, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xfd, 0x1c, 0x00, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xfd, 0x2a, 0x00, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0b, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x02, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0x03, 0x4d, 0xff, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x04, 0x00, 0x03, 0x4d, 0xf8, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfd, 0x3e, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x08, 0x04, 0x00, 0xff, 0x04, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x02, 0x37, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x4a, 0x02, 0x2e, 0xfe, 0x32, 0x46, 0x04, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x02, 0x3e, 0x06, 0x4d, 0xff, 0x2e, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf8, 0x08, 0x2e, 0x46, 0x4d, 0x46, 0x3e, 0x1c, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3e, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_16_image = {(void *) &screensaver_16, 256, 64};
-
-static void screensaver_17(uint8_t *data)
-{
-    const uint8_t image_data[1357] =
-    {
-        0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x05, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x03, 0x00, 0xf9, 0x25, 0x31, 0x2e, 0x0d, 0x03, 0x1c, 0x2c, 0x02, 0x31, 0xfd, 0x25, 0x19, 0x01, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2e, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xf9, 0x07, 0x31, 0x33, 0x31, 0x03, 0x00, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xfd, 0x14, 0x00, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x14, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0b, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0d, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x02, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x03, 0x1c, 0x2c, 0x33, 0x31, 0x25, 0x19, 0x03, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfd, 0x25, 0x01, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x07, 0x04, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x14, 0x03, 0x00, 0xfe, 0x01, 0x25, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x31, 0x02, 0x1e, 0xfe, 0x25, 0x2c, 0x04, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x01, 0x29, 0x06, 0x33, 0xff, 0x1e, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf8, 0x03, 0x1e, 0x2e, 0x33, 0x2e, 0x25, 0x14, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00
-    };
-    memcpy(data, image_data, sizeof(image_data));
-}
-static const Image screensaver_17_image = {(void *) &screensaver_17, 256, 64};
+static const uint8_t image_data_screensaver_1[1357] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x05, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x03, 0x00, 0xf9, 0x25, 0x31, 0x2e, 0x0d, 0x03, 0x1c, 0x2c, 0x02, 0x31, 0xfd, 0x25, 0x19, 0x01, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2e, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xf9, 0x07, 0x31, 0x33, 0x31, 0x03, 0x00, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xfd, 0x14, 0x00, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x14, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0b, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0d, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x02, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x03, 0x1c, 0x2c, 0x33, 0x31, 0x25, 0x19, 0x03, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfd, 0x25, 0x01, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x07, 0x04, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x14, 0x03, 0x00, 0xfe, 0x01, 0x25, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x31, 0x02, 0x1e, 0xfe, 0x25, 0x2c, 0x04, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x01, 0x29, 0x06, 0x33, 0xff, 0x1e, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf8, 0x03, 0x1e, 0x2e, 0x33, 0x2e, 0x25, 0x14, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00
+};
+static const Image screensaver_1_image = {image_data_screensaver_1, 256, 64};
+
+static const uint8_t image_data_screensaver_2[1354] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x05, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x03, 0x00, 0xf4, 0x37, 0x4a, 0x46, 0x1c, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x02, 0x00, 0x03, 0x4d, 0x02, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xff, 0x46, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xf9, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x00, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xfd, 0x1c, 0x00, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xfd, 0x2a, 0x00, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0b, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x02, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0x03, 0x4d, 0xff, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x04, 0x00, 0x03, 0x4d, 0xf8, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfd, 0x3e, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x08, 0x04, 0x00, 0xff, 0x04, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x02, 0x37, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x4a, 0x02, 0x2e, 0xfe, 0x32, 0x46, 0x04, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x02, 0x3e, 0x06, 0x4d, 0xff, 0x2e, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf8, 0x08, 0x2e, 0x46, 0x4d, 0x46, 0x3e, 0x1c, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00
+};
+static const Image screensaver_2_image = {image_data_screensaver_2, 256, 64};
+
+static const uint8_t image_data_screensaver_3[1363] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x05, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x03, 0x00, 0xf4, 0x47, 0x61, 0x5d, 0x23, 0x06, 0x39, 0x5a, 0x64, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x02, 0x00, 0x03, 0x66, 0x02, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xf9, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x00, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xfd, 0x23, 0x00, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xfd, 0x39, 0x00, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x47, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x41, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0a, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x02, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x0b, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0x03, 0x66, 0xff, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x06, 0x39, 0x5a, 0x66, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfd, 0x52, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x06, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x23, 0x03, 0x00, 0xfe, 0x02, 0x47, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x61, 0x02, 0x41, 0xfe, 0x47, 0x5a, 0x04, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x02, 0x52, 0x06, 0x66, 0xff, 0x39, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf8, 0x0b, 0x41, 0x5d, 0x64, 0x5d, 0x52, 0x23, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3e, 0x00
+};
+static const Image screensaver_3_image = {image_data_screensaver_3, 256, 64};
+
+static const uint8_t image_data_screensaver_4[1360] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00, 0xfc, 0x5a, 0x7a, 0x72, 0x2b, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x72, 0x02, 0x80, 0xff, 0x7d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x05, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x03, 0x00, 0xf4, 0x5a, 0x7a, 0x72, 0x2b, 0x07, 0x47, 0x6e, 0x7d, 0x76, 0x66, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfe, 0x66, 0x07, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfe, 0x66, 0x07, 0x02, 0x00, 0x03, 0x80, 0x02, 0x6e, 0x06, 0x80, 0xfe, 0x6e, 0x14, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0xff, 0x72, 0x0b, 0x80, 0xff, 0x5a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xf9, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x00, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xfb, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x02, 0x00, 0x03, 0x80, 0xfa, 0x51, 0x14, 0x07, 0x02, 0x14, 0x6e, 0x02, 0x80, 0xff, 0x7a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xfd, 0x2b, 0x00, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x2b, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x2b, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xfd, 0x47, 0x00, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xfe, 0x5a, 0x00, 0x0c, 0x80, 0xff, 0x5a, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x02, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xfe, 0x51, 0x00, 0x0c, 0x80, 0xff, 0x51, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x02, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x47, 0x03, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0b, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0c, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0b, 0x00, 0x03, 0x80, 0x05, 0x00, 0xff, 0x2b, 0x03, 0x80, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x02, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x03, 0x00, 0x03, 0x80, 0xfa, 0x51, 0x14, 0x07, 0x02, 0x14, 0x6e, 0x02, 0x80, 0xff, 0x7a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0x0b, 0x80, 0xff, 0x5a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x06, 0x80, 0xfe, 0x6e, 0x14, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x05, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x04, 0x00, 0x03, 0x80, 0xf8, 0x07, 0x47, 0x6e, 0x80, 0x76, 0x66, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x28, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x6e, 0x02, 0x80, 0xfc, 0x7d, 0x6e, 0x3c, 0x02, 0x02, 0x00, 0x05, 0x80, 0x04, 0x00, 0x05, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x14, 0x6e, 0x07, 0x80, 0xfd, 0x66, 0x07, 0x00, 0x05, 0x80, 0x04, 0x00, 0x05, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x03, 0x00, 0xff, 0x66, 0x03, 0x80, 0xff, 0x5a, 0x02, 0x51, 0xff, 0x76, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x02, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2b, 0x02, 0x80, 0xfe, 0x7a, 0x2b, 0x03, 0x00, 0xfb, 0x14, 0x76, 0x80, 0x7d, 0x07, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x80, 0xff, 0x2b, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6e, 0x02, 0x80, 0xff, 0x14, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xff, 0x5a, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x80, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x80, 0xff, 0x51, 0x02, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x47, 0x03, 0x80, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x72, 0x80, 0x7a, 0x0c, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x5a, 0x03, 0x80, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x76, 0x02, 0x80, 0xff, 0x14, 0x04, 0x00, 0xff, 0x07, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x66, 0x03, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2b, 0x51, 0x07, 0x03, 0x00, 0xff, 0x5a, 0x02, 0x80, 0xff, 0x3c, 0x03, 0x00, 0xfe, 0x02, 0x5a, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x04, 0x80, 0x02, 0x00, 0xfe, 0x07, 0x72, 0x02, 0x80, 0xff, 0x6e, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x02, 0x80, 0xff, 0x47, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x80, 0xff, 0x7a, 0x02, 0x51, 0xfe, 0x5a, 0x72, 0x04, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x04, 0x00, 0xfe, 0x14, 0x76, 0x03, 0x80, 0x03, 0x00, 0xfe, 0x2b, 0x7a, 0x08, 0x80, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x07, 0x6e, 0x06, 0x80, 0xff, 0x51, 0x03, 0x80, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x80, 0x05, 0x00, 0xfe, 0x14, 0x7a, 0x02, 0x80, 0x04, 0x00, 0xf7, 0x14, 0x51, 0x72, 0x80, 0x7a, 0x72, 0x5a, 0x47, 0x2b, 0x05, 0x00, 0xf8, 0x07, 0x51, 0x72, 0x80, 0x76, 0x66, 0x2b, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x80, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x72, 0x02, 0x80, 0xff, 0x7d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x80, 0xff, 0x6e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x5a, 0x7a, 0x76, 0x2b, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00
+};
+static const Image screensaver_4_image = {image_data_screensaver_4, 256, 64};
+
+static const uint8_t image_data_screensaver_5[1353] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x05, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x03, 0x00, 0xf4, 0x6c, 0x94, 0x8b, 0x30, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x02, 0x00, 0x03, 0x99, 0x02, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x02, 0x00, 0xff, 0x8b, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xf9, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x00, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xfd, 0x44, 0x00, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfd, 0x50, 0x00, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x6c, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x62, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0b, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0a, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x02, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0x03, 0x99, 0xff, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfd, 0x7a, 0x08, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x08, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfb, 0x94, 0x62, 0x59, 0x6c, 0x8b, 0x04, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x03, 0x84, 0x06, 0x99, 0xff, 0x59, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf8, 0x0e, 0x62, 0x8b, 0x99, 0x8b, 0x7a, 0x44, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00
+};
+static const Image screensaver_5_image = {image_data_screensaver_5, 256, 64};
+
+static const uint8_t image_data_screensaver_6[1357] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x5b, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x05, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x03, 0x00, 0xf4, 0x79, 0xaa, 0xa4, 0x37, 0x09, 0x62, 0x94, 0xb0, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x02, 0x94, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xff, 0xa4, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xf9, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x00, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xfd, 0x4f, 0x00, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xfd, 0x62, 0x00, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0b, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0a, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x02, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0x03, 0xb3, 0xff, 0x9e, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x04, 0x00, 0x03, 0xb3, 0xf8, 0x09, 0x62, 0x9e, 0xb3, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x02, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfd, 0x84, 0x09, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x09, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x4f, 0x03, 0x00, 0xfe, 0x03, 0x79, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0xaa, 0x02, 0x70, 0xfe, 0x79, 0x9e, 0x04, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x03, 0x94, 0x06, 0xb3, 0xff, 0x70, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf8, 0x09, 0x70, 0xa4, 0xb3, 0xa4, 0x84, 0x4f, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x20, 0x00
+};
+static const Image screensaver_6_image = {image_data_screensaver_6, 256, 64};
+
+static const uint8_t image_data_screensaver_7[1372] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x64, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x05, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x03, 0x00, 0xf4, 0x8b, 0xc2, 0xbb, 0x40, 0x0a, 0x72, 0xad, 0xc8, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x08, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xf9, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x00, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xfd, 0x40, 0x00, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xfd, 0x72, 0x00, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0b, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x02, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x0b, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x04, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x72, 0xb4, 0xcc, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfd, 0x9b, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x03, 0x05, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xfe, 0x03, 0x8b, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0xc2, 0x02, 0x80, 0xfe, 0x8b, 0xb4, 0x04, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x06, 0xcc, 0xff, 0x80, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf8, 0x0a, 0x80, 0xbb, 0xc8, 0xbb, 0x9b, 0x5f, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x17, 0x00
+};
+static const Image screensaver_7_image = {image_data_screensaver_7, 256, 64};
+
+static const uint8_t image_data_screensaver_8[1365] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x6e, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x05, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x03, 0x00, 0xf4, 0x9c, 0xdb, 0xd2, 0x48, 0x0b, 0x80, 0xbe, 0xe2, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfe, 0xbe, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x08, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xf9, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x00, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xfd, 0x48, 0x00, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xfd, 0x80, 0x00, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0b, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x02, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x0b, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0x03, 0xe6, 0xff, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x04, 0x00, 0x03, 0xe6, 0xf8, 0x0b, 0x80, 0xcb, 0xe6, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x02, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfd, 0xaa, 0x0b, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x21, 0x04, 0x00, 0xff, 0x0b, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xfe, 0x04, 0x9c, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0xdb, 0x02, 0x91, 0xfe, 0x9c, 0xcb, 0x04, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x0b, 0xbe, 0x06, 0xe6, 0xff, 0x91, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf8, 0x0b, 0x91, 0xd2, 0xe2, 0xd2, 0xaa, 0x6b, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x0d, 0x00
+};
+static const Image screensaver_8_image = {image_data_screensaver_8, 256, 64};
+
+static const uint8_t image_data_screensaver_9[1365] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x78, 0x00, 0xfc, 0xac, 0xf2, 0xe9, 0x4e, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xff, 0xff, 0xd3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0xfb, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x05, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x03, 0x00, 0xf4, 0xac, 0xf2, 0xe9, 0x4e, 0x0d, 0x8c, 0xd3, 0xfb, 0xf2, 0xbd, 0x71, 0x0d, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfe, 0xbd, 0x0d, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfe, 0xbd, 0x0d, 0x02, 0x00, 0x03, 0xff, 0xfe, 0xd3, 0xe1, 0x06, 0xff, 0xfe, 0xe1, 0x24, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0xfb, 0x08, 0xff, 0xff, 0xac, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xf9, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x00, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xfb, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x02, 0x00, 0x03, 0xff, 0xfa, 0xac, 0x4e, 0x0d, 0x04, 0x24, 0xd3, 0x02, 0xff, 0xff, 0xf2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xfd, 0x71, 0x00, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xff, 0x71, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x4e, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xfd, 0x8c, 0x00, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x24, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xac, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x04, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xfe, 0xac, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x04, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8c, 0x03, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0b, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0c, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x24, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0a, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0b, 0x00, 0x03, 0xff, 0x05, 0x00, 0xff, 0x4e, 0x03, 0xff, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x02, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x03, 0x00, 0x03, 0xff, 0xfa, 0xac, 0x4e, 0x0d, 0x04, 0x24, 0xd3, 0x02, 0xff, 0xff, 0xf2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x0b, 0xff, 0xff, 0xac, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0x03, 0xff, 0xff, 0xe1, 0x06, 0xff, 0xfe, 0xe1, 0x24, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x05, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x04, 0x00, 0x03, 0xff, 0xf8, 0x0d, 0x8c, 0xe1, 0xff, 0xf2, 0xbd, 0x71, 0x0d, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x28, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xfd, 0x0d, 0x8c, 0xe1, 0x02, 0xff, 0xfc, 0xfb, 0xe1, 0x71, 0x04, 0x02, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x24, 0xe1, 0x07, 0xff, 0xfd, 0xbd, 0x0d, 0x00, 0x05, 0xff, 0x04, 0x00, 0x05, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x03, 0x00, 0xff, 0xd3, 0x02, 0xff, 0xfe, 0xfb, 0xbd, 0x02, 0xa0, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x02, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x4e, 0x02, 0xff, 0xfe, 0xf2, 0x4e, 0x03, 0x00, 0xfb, 0x24, 0xf2, 0xff, 0xfb, 0x0d, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xac, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xa0, 0x02, 0xff, 0xff, 0x71, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0x24, 0x05, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x0c, 0xff, 0xff, 0xac, 0x02, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x8c, 0x03, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0xe9, 0xff, 0xf2, 0x0c, 0x00, 0x03, 0xff, 0x06, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x04, 0xac, 0x03, 0xff, 0xff, 0x8c, 0x04, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x0d, 0x0b, 0x00, 0xff, 0xe9, 0x02, 0xff, 0xff, 0x24, 0x04, 0x00, 0xff, 0x0d, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xbd, 0x03, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0x8c, 0x05, 0x00, 0xfd, 0x4e, 0xa0, 0x0d, 0x03, 0x00, 0xff, 0xbd, 0x02, 0xff, 0xff, 0x71, 0x03, 0x00, 0xfe, 0x04, 0xac, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x0d, 0xe1, 0x04, 0xff, 0x02, 0x00, 0xfe, 0x0d, 0xe9, 0x02, 0xff, 0xfb, 0xd3, 0xac, 0xa0, 0xac, 0xe9, 0x02, 0xff, 0xff, 0x8c, 0x03, 0x00, 0xff, 0x71, 0x02, 0xff, 0xff, 0xf2, 0x02, 0xa0, 0xfe, 0xac, 0xe1, 0x04, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x04, 0x00, 0xfe, 0x24, 0xe9, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x4e, 0xf2, 0x08, 0xff, 0xff, 0xa0, 0x03, 0x00, 0xfe, 0x0d, 0xd3, 0x06, 0xff, 0xff, 0xa0, 0x03, 0xff, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xff, 0x05, 0x00, 0xfe, 0x24, 0xf2, 0x02, 0xff, 0x04, 0x00, 0xf7, 0x24, 0xa0, 0xe1, 0xff, 0xf2, 0xe9, 0xbd, 0x8c, 0x4e, 0x05, 0x00, 0xf8, 0x0d, 0xa0, 0xe9, 0xfb, 0xe9, 0xbd, 0x71, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xff, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xe1, 0x02, 0xff, 0xff, 0xfb, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xff, 0xff, 0xd3, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0xac, 0xf2, 0xe9, 0x4e, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x03, 0x00
+};
+static const Image screensaver_9_image = {image_data_screensaver_9, 256, 64};
+
+static const uint8_t image_data_screensaver_10[1365] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x03, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x05, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x03, 0x00, 0xf4, 0x9c, 0xdb, 0xd2, 0x48, 0x0b, 0x80, 0xbe, 0xe2, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfe, 0xaa, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfe, 0xbe, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0xe2, 0x08, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xf9, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x00, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xfd, 0x48, 0x00, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xfd, 0x80, 0x00, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xfe, 0x9c, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x04, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0b, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x21, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xff, 0x48, 0x03, 0xe6, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x02, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0x03, 0xe6, 0xfa, 0x9c, 0x21, 0x0b, 0x04, 0x21, 0xbe, 0x02, 0xe6, 0xff, 0xdb, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x0b, 0xe6, 0xff, 0x9c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0x03, 0xe6, 0xff, 0xcb, 0x06, 0xe6, 0xfe, 0xcb, 0x21, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x04, 0x00, 0x03, 0xe6, 0xf8, 0x0b, 0x80, 0xcb, 0xe6, 0xdb, 0xaa, 0x6b, 0x0b, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x28, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xfd, 0x0b, 0x80, 0xcb, 0x02, 0xe6, 0xfc, 0xe2, 0xcb, 0x6b, 0x04, 0x02, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x21, 0xcb, 0x07, 0xe6, 0xfd, 0xaa, 0x0b, 0x00, 0x05, 0xe6, 0x04, 0x00, 0x05, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x03, 0x00, 0xff, 0xbe, 0x02, 0xe6, 0xfe, 0xe2, 0xaa, 0x02, 0x91, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x02, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x48, 0x02, 0xe6, 0xfe, 0xdb, 0x48, 0x03, 0x00, 0xfb, 0x21, 0xdb, 0xe6, 0xe2, 0x0b, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0x9c, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xff, 0x91, 0x02, 0xe6, 0xff, 0x48, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0x21, 0x05, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xe6, 0xff, 0x6b, 0x06, 0x00, 0x0c, 0xe6, 0xff, 0x9c, 0x02, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfe, 0x00, 0x80, 0x03, 0xe6, 0xff, 0x6b, 0x05, 0x00, 0xfd, 0xd2, 0xe6, 0xdb, 0x0c, 0x00, 0x03, 0xe6, 0x06, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x04, 0x9c, 0x03, 0xe6, 0xff, 0x6b, 0x04, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x0b, 0x0b, 0x00, 0xff, 0xd2, 0x02, 0xe6, 0xff, 0x21, 0x04, 0x00, 0xff, 0x0b, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xaa, 0x03, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0x80, 0x05, 0x00, 0xfd, 0x48, 0x91, 0x0b, 0x03, 0x00, 0xff, 0xaa, 0x02, 0xe6, 0xff, 0x6b, 0x03, 0x00, 0xfe, 0x04, 0x9c, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x0b, 0xcb, 0x04, 0xe6, 0x02, 0x00, 0xfe, 0x0b, 0xd2, 0x02, 0xe6, 0xfb, 0xbe, 0x9c, 0x91, 0x9c, 0xd2, 0x02, 0xe6, 0xff, 0x80, 0x03, 0x00, 0xff, 0x6b, 0x02, 0xe6, 0xff, 0xdb, 0x02, 0x91, 0xfe, 0x9c, 0xcb, 0x04, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x04, 0x00, 0xfe, 0x21, 0xd2, 0x03, 0xe6, 0x03, 0x00, 0xfe, 0x48, 0xdb, 0x08, 0xe6, 0xff, 0x91, 0x03, 0x00, 0xfe, 0x0b, 0xbe, 0x06, 0xe6, 0xff, 0x91, 0x03, 0xe6, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xe6, 0x05, 0x00, 0xfe, 0x21, 0xdb, 0x02, 0xe6, 0x04, 0x00, 0xf7, 0x21, 0x91, 0xcb, 0xe6, 0xdb, 0xd2, 0xaa, 0x80, 0x48, 0x05, 0x00, 0xf8, 0x0b, 0x91, 0xd2, 0xe2, 0xd2, 0xaa, 0x6b, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xe6, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xcb, 0x02, 0xe6, 0xff, 0xe2, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xe6, 0xff, 0xbe, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x9c, 0xdb, 0xd2, 0x48, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x78, 0x00
+};
+static const Image screensaver_10_image = {image_data_screensaver_10, 256, 64};
+
+static const uint8_t image_data_screensaver_11[1372] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x0c, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x05, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x03, 0x00, 0xf4, 0x8b, 0xc2, 0xbb, 0x40, 0x0a, 0x72, 0xad, 0xc8, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfe, 0x9b, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x02, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x08, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xf9, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x00, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xfd, 0x40, 0x00, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xfd, 0x72, 0x00, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xfe, 0x8b, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x03, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0b, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x1e, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xff, 0x40, 0x03, 0xcc, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x02, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0x03, 0xcc, 0xfa, 0x8b, 0x1e, 0x0a, 0x03, 0x1e, 0xad, 0x02, 0xcc, 0xff, 0xc2, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x0b, 0xcc, 0xff, 0x8b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x06, 0xcc, 0xfe, 0xb4, 0x1e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x04, 0x00, 0x03, 0xcc, 0xf8, 0x0a, 0x72, 0xb4, 0xcc, 0xc2, 0x9b, 0x5f, 0x0a, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x28, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xfd, 0x0a, 0x72, 0xb4, 0x02, 0xcc, 0xfc, 0xc8, 0xb4, 0x5f, 0x03, 0x02, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x1e, 0xb4, 0x07, 0xcc, 0xfd, 0x9b, 0x0a, 0x00, 0x05, 0xcc, 0x04, 0x00, 0x05, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x03, 0x9b, 0x02, 0xcc, 0xfe, 0xc8, 0x9b, 0x02, 0x80, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x02, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x40, 0x02, 0xcc, 0xfe, 0xc8, 0x40, 0x03, 0x00, 0xfb, 0x1e, 0xc2, 0xcc, 0xc8, 0x0a, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x8b, 0x02, 0xcc, 0xff, 0x72, 0x05, 0x00, 0xff, 0x80, 0x02, 0xcc, 0xff, 0x40, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xff, 0xad, 0x02, 0xcc, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xcc, 0xff, 0x5f, 0x06, 0x00, 0x0c, 0xcc, 0xff, 0x8b, 0x02, 0x00, 0x03, 0xcc, 0x06, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfe, 0x00, 0x72, 0x03, 0xcc, 0xff, 0x5f, 0x05, 0x00, 0xfd, 0xbb, 0xcc, 0xc2, 0x0c, 0x00, 0x03, 0xcc, 0xff, 0x03, 0x05, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0xfd, 0x00, 0x03, 0x8b, 0x03, 0xcc, 0xff, 0x5f, 0x04, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x0a, 0x0b, 0x00, 0xff, 0xbb, 0x02, 0xcc, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x0a, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0x9b, 0x03, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0x72, 0x04, 0x00, 0xfc, 0x03, 0x40, 0x80, 0x0a, 0x03, 0x00, 0xff, 0x9b, 0x02, 0xcc, 0xff, 0x5f, 0x03, 0x00, 0xfe, 0x03, 0x8b, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x04, 0xcc, 0x02, 0x00, 0xfe, 0x0a, 0xbb, 0x02, 0xcc, 0xfb, 0xad, 0x8b, 0x80, 0x8b, 0xb4, 0x02, 0xcc, 0xff, 0x72, 0x03, 0x00, 0xff, 0x5f, 0x02, 0xcc, 0xff, 0xc2, 0x02, 0x80, 0xfe, 0x8b, 0xb4, 0x04, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x04, 0x00, 0xfe, 0x1e, 0xbb, 0x03, 0xcc, 0x03, 0x00, 0xfe, 0x40, 0xc2, 0x08, 0xcc, 0xff, 0x80, 0x03, 0x00, 0xfe, 0x0a, 0xad, 0x06, 0xcc, 0xff, 0x80, 0x03, 0xcc, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xcc, 0x05, 0x00, 0xfe, 0x1e, 0xc2, 0x02, 0xcc, 0x04, 0x00, 0xf7, 0x1e, 0x80, 0xb4, 0xcc, 0xc8, 0xb4, 0x9b, 0x72, 0x40, 0x05, 0x00, 0xf8, 0x0a, 0x80, 0xbb, 0xc8, 0xbb, 0x9b, 0x5f, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xcc, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xb4, 0x02, 0xcc, 0xff, 0xc8, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xcc, 0xff, 0xad, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x8b, 0xc2, 0xbb, 0x40, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x6f, 0x00
+};
+static const Image screensaver_11_image = {image_data_screensaver_11, 256, 64};
+
+static const uint8_t image_data_screensaver_12[1357] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x16, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x05, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x03, 0x00, 0xf4, 0x79, 0xaa, 0xa4, 0x37, 0x09, 0x62, 0x94, 0xb0, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfe, 0x84, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x02, 0x94, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xff, 0xa4, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xf9, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x00, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xfd, 0x4f, 0x00, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xfd, 0x62, 0x00, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xfe, 0x79, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x03, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0b, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x1a, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0a, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xff, 0x37, 0x03, 0xb3, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x02, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0x03, 0xb3, 0xfa, 0x79, 0x37, 0x09, 0x03, 0x1a, 0x94, 0x02, 0xb3, 0xff, 0xaa, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x0b, 0xb3, 0xff, 0x79, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0x03, 0xb3, 0xff, 0x9e, 0x06, 0xb3, 0xfe, 0x9e, 0x1a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x04, 0x00, 0x03, 0xb3, 0xf8, 0x09, 0x62, 0x9e, 0xb3, 0xaa, 0x84, 0x4f, 0x09, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x28, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xfd, 0x09, 0x62, 0x9e, 0x02, 0xb3, 0xfc, 0xb0, 0x9e, 0x4f, 0x03, 0x02, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x1a, 0x9e, 0x07, 0xb3, 0xfd, 0x84, 0x09, 0x00, 0x05, 0xb3, 0x04, 0x00, 0x05, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x03, 0x00, 0xff, 0x94, 0x03, 0xb3, 0xff, 0x84, 0x02, 0x70, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x02, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x53, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x37, 0x02, 0xb3, 0xfe, 0xaa, 0x37, 0x03, 0x00, 0xfb, 0x1a, 0xaa, 0xb3, 0xb0, 0x09, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x79, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x70, 0x02, 0xb3, 0xff, 0x4f, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x08, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x07, 0xb3, 0xff, 0x62, 0x06, 0x00, 0x0c, 0xb3, 0xff, 0x79, 0x02, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfe, 0x00, 0x70, 0x03, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0xa4, 0xb3, 0xaa, 0x0c, 0x00, 0x03, 0xb3, 0x06, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0xfd, 0x00, 0x03, 0x79, 0x03, 0xb3, 0xff, 0x62, 0x04, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x09, 0x0b, 0x00, 0xff, 0xa4, 0x02, 0xb3, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x09, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0x94, 0x03, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0x62, 0x05, 0x00, 0xfd, 0x37, 0x70, 0x09, 0x03, 0x00, 0xff, 0x84, 0x02, 0xb3, 0xff, 0x4f, 0x03, 0x00, 0xfe, 0x03, 0x79, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x09, 0x9e, 0x04, 0xb3, 0x02, 0x00, 0xfe, 0x09, 0xa4, 0x02, 0xb3, 0xfb, 0x94, 0x79, 0x70, 0x79, 0xa4, 0x02, 0xb3, 0xff, 0x62, 0x03, 0x00, 0xff, 0x4f, 0x02, 0xb3, 0xff, 0xaa, 0x02, 0x70, 0xfe, 0x79, 0x9e, 0x04, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x04, 0x00, 0xfe, 0x1a, 0xa4, 0x03, 0xb3, 0x03, 0x00, 0xfe, 0x37, 0xaa, 0x08, 0xb3, 0xff, 0x70, 0x03, 0x00, 0xfe, 0x03, 0x94, 0x06, 0xb3, 0xff, 0x70, 0x03, 0xb3, 0x7f, 0x00, 0x58, 0x00, 0x03, 0xb3, 0x05, 0x00, 0xfe, 0x1a, 0xaa, 0x02, 0xb3, 0x04, 0x00, 0xf7, 0x1a, 0x70, 0x9e, 0xb3, 0xaa, 0xa4, 0x84, 0x62, 0x37, 0x05, 0x00, 0xf8, 0x09, 0x70, 0xa4, 0xb3, 0xa4, 0x84, 0x4f, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0xb3, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x9e, 0x02, 0xb3, 0xff, 0xb0, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0xb3, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x79, 0xaa, 0xa4, 0x37, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x65, 0x00
+};
+static const Image screensaver_12_image = {image_data_screensaver_12, 256, 64};
+
+static const uint8_t image_data_screensaver_13[1353] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x20, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x05, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x03, 0x00, 0xf4, 0x6c, 0x94, 0x8b, 0x30, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfe, 0x7a, 0x08, 0x02, 0x00, 0x03, 0x99, 0x02, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x02, 0x00, 0xff, 0x8b, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xf9, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x00, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xfd, 0x44, 0x00, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfd, 0x50, 0x00, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x6c, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xfe, 0x62, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x03, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0b, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x0e, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0a, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0x03, 0x99, 0x05, 0x00, 0xff, 0x30, 0x03, 0x99, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x02, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0x03, 0x99, 0xfa, 0x62, 0x1a, 0x08, 0x03, 0x1a, 0x84, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0x0b, 0x99, 0xff, 0x6c, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0x03, 0x99, 0xff, 0x84, 0x06, 0x99, 0xfe, 0x84, 0x0e, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x04, 0x00, 0x03, 0x99, 0xf8, 0x08, 0x50, 0x84, 0x99, 0x8b, 0x7a, 0x44, 0x08, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x28, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xfd, 0x08, 0x50, 0x84, 0x02, 0x99, 0xfc, 0x94, 0x84, 0x50, 0x03, 0x02, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x07, 0x99, 0xfd, 0x7a, 0x08, 0x00, 0x05, 0x99, 0x04, 0x00, 0x05, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x03, 0x00, 0xff, 0x7a, 0x03, 0x99, 0xfc, 0x6c, 0x59, 0x62, 0x8b, 0x02, 0x99, 0xff, 0x59, 0x03, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x02, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x30, 0x02, 0x99, 0xfe, 0x94, 0x30, 0x03, 0x00, 0xfb, 0x0e, 0x94, 0x99, 0x94, 0x0e, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x62, 0x02, 0x99, 0xff, 0x44, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x99, 0xff, 0x50, 0x05, 0x00, 0xff, 0x84, 0x02, 0x99, 0xff, 0x1a, 0x05, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x50, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x6c, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x99, 0xff, 0x50, 0x06, 0x00, 0x0c, 0x99, 0xff, 0x62, 0x02, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfe, 0x00, 0x59, 0x03, 0x99, 0xff, 0x50, 0x05, 0x00, 0xfd, 0x8b, 0x99, 0x94, 0x0c, 0x00, 0x03, 0x99, 0x06, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0xfd, 0x00, 0x03, 0x6c, 0x03, 0x99, 0xff, 0x50, 0x04, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x08, 0x0b, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x08, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x7a, 0x03, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xff, 0x59, 0x05, 0x00, 0xfd, 0x30, 0x59, 0x08, 0x03, 0x00, 0xff, 0x6c, 0x02, 0x99, 0xff, 0x44, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x0e, 0x84, 0x04, 0x99, 0x02, 0x00, 0xfe, 0x08, 0x8b, 0x02, 0x99, 0xfb, 0x84, 0x62, 0x59, 0x6c, 0x8b, 0x02, 0x99, 0xff, 0x50, 0x03, 0x00, 0xff, 0x44, 0x02, 0x99, 0xfb, 0x94, 0x62, 0x59, 0x6c, 0x8b, 0x04, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x04, 0x00, 0xfe, 0x1a, 0x8b, 0x03, 0x99, 0x03, 0x00, 0xfe, 0x30, 0x94, 0x08, 0x99, 0xff, 0x62, 0x03, 0x00, 0xfe, 0x03, 0x84, 0x06, 0x99, 0xff, 0x59, 0x03, 0x99, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x99, 0x05, 0x00, 0xfe, 0x1a, 0x94, 0x02, 0x99, 0x04, 0x00, 0xf7, 0x1a, 0x62, 0x8b, 0x99, 0x94, 0x8b, 0x6c, 0x59, 0x30, 0x05, 0x00, 0xf8, 0x0e, 0x62, 0x8b, 0x99, 0x8b, 0x7a, 0x44, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x99, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x8b, 0x02, 0x99, 0xff, 0x94, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x99, 0xff, 0x84, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x6c, 0x94, 0x8b, 0x30, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x5b, 0x00
+};
+static const Image screensaver_13_image = {image_data_screensaver_13, 256, 64};
+
+static const uint8_t image_data_screensaver_14[1362] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x2a, 0x00, 0xfc, 0x57, 0x78, 0x74, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x70, 0x02, 0x7f, 0xff, 0x7c, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x05, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x03, 0x00, 0xf4, 0x57, 0x78, 0x74, 0x2c, 0x07, 0x47, 0x6c, 0x7f, 0x78, 0x60, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfe, 0x60, 0x03, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfe, 0x60, 0x03, 0x02, 0x00, 0x03, 0x7f, 0x02, 0x6c, 0x06, 0x7f, 0xfe, 0x6c, 0x15, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0xff, 0x70, 0x0b, 0x7f, 0xff, 0x57, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xf9, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x00, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xfb, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x02, 0x00, 0x03, 0x7f, 0xfe, 0x51, 0x15, 0x02, 0x03, 0xfe, 0x15, 0x6c, 0x02, 0x7f, 0xff, 0x78, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xfd, 0x2c, 0x00, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xff, 0x2c, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x2c, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xfd, 0x47, 0x00, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xfe, 0x57, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x03, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xfe, 0x57, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x03, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0xfe, 0x00, 0x47, 0x03, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0b, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0c, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0a, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0b, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xff, 0x2c, 0x03, 0x7f, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x02, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x03, 0x00, 0x03, 0x7f, 0xfe, 0x51, 0x15, 0x02, 0x03, 0xfe, 0x15, 0x6c, 0x02, 0x7f, 0xff, 0x78, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0x0b, 0x7f, 0xff, 0x57, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x06, 0x7f, 0xfe, 0x70, 0x15, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x05, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x04, 0x00, 0x03, 0x7f, 0xf8, 0x07, 0x47, 0x70, 0x7f, 0x78, 0x60, 0x3c, 0x07, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x28, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xfd, 0x07, 0x47, 0x70, 0x02, 0x7f, 0xfc, 0x7c, 0x70, 0x3c, 0x03, 0x02, 0x00, 0x05, 0x7f, 0x04, 0x00, 0x05, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x70, 0x07, 0x7f, 0xfd, 0x60, 0x03, 0x00, 0x05, 0x7f, 0x04, 0x00, 0x05, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x03, 0x00, 0xff, 0x60, 0x03, 0x7f, 0xff, 0x60, 0x02, 0x51, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x02, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x2c, 0x02, 0x7f, 0xfe, 0x7c, 0x2c, 0x03, 0x00, 0xfb, 0x15, 0x78, 0x7f, 0x7c, 0x07, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x57, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xff, 0x51, 0x02, 0x7f, 0xff, 0x2c, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xff, 0x6c, 0x02, 0x7f, 0xff, 0x15, 0x05, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x7f, 0xff, 0x3c, 0x06, 0x00, 0x0c, 0x7f, 0xff, 0x57, 0x02, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0xfe, 0x00, 0x47, 0x03, 0x7f, 0xff, 0x3c, 0x05, 0x00, 0xfd, 0x74, 0x7f, 0x78, 0x0c, 0x00, 0x03, 0x7f, 0x06, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xff, 0x57, 0x03, 0x7f, 0xff, 0x3c, 0x04, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x07, 0x0b, 0x00, 0xff, 0x74, 0x02, 0x7f, 0xff, 0x15, 0x04, 0x00, 0xff, 0x07, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x02, 0x00, 0xfe, 0x03, 0x60, 0x03, 0x7f, 0xff, 0x3c, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x47, 0x05, 0x00, 0xfd, 0x2c, 0x51, 0x07, 0x03, 0x00, 0xff, 0x60, 0x02, 0x7f, 0xff, 0x2c, 0x03, 0x00, 0xfe, 0x03, 0x57, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x07, 0x6c, 0x04, 0x7f, 0x02, 0x00, 0xfe, 0x07, 0x74, 0x02, 0x7f, 0xff, 0x6c, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x02, 0x7f, 0xff, 0x47, 0x03, 0x00, 0xff, 0x3c, 0x02, 0x7f, 0xff, 0x78, 0x02, 0x51, 0xfe, 0x57, 0x70, 0x04, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x04, 0x00, 0xfe, 0x15, 0x74, 0x03, 0x7f, 0x03, 0x00, 0xfe, 0x15, 0x78, 0x08, 0x7f, 0xff, 0x51, 0x03, 0x00, 0xfe, 0x03, 0x6c, 0x06, 0x7f, 0xff, 0x51, 0x03, 0x7f, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x7f, 0x05, 0x00, 0xfe, 0x15, 0x78, 0x02, 0x7f, 0x04, 0x00, 0xf7, 0x15, 0x51, 0x70, 0x7f, 0x7c, 0x70, 0x60, 0x47, 0x2c, 0x05, 0x00, 0xf8, 0x07, 0x51, 0x74, 0x7f, 0x74, 0x60, 0x2c, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x70, 0x02, 0x7f, 0xff, 0x7c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x7f, 0xff, 0x6c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x57, 0x78, 0x74, 0x2c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x51, 0x00
+};
+static const Image screensaver_14_image = {image_data_screensaver_14, 256, 64};
+
+static const uint8_t image_data_screensaver_15[1363] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x05, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x03, 0x00, 0xf4, 0x47, 0x61, 0x5d, 0x23, 0x06, 0x39, 0x5a, 0x64, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfe, 0x52, 0x02, 0x02, 0x00, 0x03, 0x66, 0x02, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x64, 0x08, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xf9, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x00, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xfd, 0x23, 0x00, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xfd, 0x39, 0x00, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x47, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xfe, 0x41, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x02, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0b, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x0b, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0a, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0x03, 0x66, 0x05, 0x00, 0xff, 0x23, 0x03, 0x66, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x02, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0x03, 0x66, 0xfe, 0x41, 0x15, 0x02, 0x02, 0xfe, 0x15, 0x5a, 0x02, 0x66, 0xff, 0x61, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x0b, 0x66, 0xff, 0x47, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0x03, 0x66, 0xff, 0x5a, 0x06, 0x66, 0xfe, 0x5a, 0x0b, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x04, 0x00, 0x03, 0x66, 0xf8, 0x06, 0x39, 0x5a, 0x66, 0x61, 0x52, 0x30, 0x06, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x28, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xfd, 0x06, 0x39, 0x5a, 0x02, 0x66, 0xfc, 0x64, 0x5a, 0x30, 0x02, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x0b, 0x5a, 0x07, 0x66, 0xfd, 0x52, 0x02, 0x00, 0x05, 0x66, 0x04, 0x00, 0x05, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x03, 0x00, 0xff, 0x52, 0x02, 0x66, 0xfb, 0x64, 0x47, 0x39, 0x41, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x02, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x23, 0x02, 0x66, 0xfe, 0x61, 0x15, 0x03, 0x00, 0xfb, 0x0b, 0x61, 0x66, 0x64, 0x06, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xff, 0x41, 0x02, 0x66, 0xff, 0x23, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x66, 0xff, 0x30, 0x05, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x15, 0x05, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x47, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x66, 0xff, 0x30, 0x06, 0x00, 0x0c, 0x66, 0xff, 0x41, 0x02, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0xfe, 0x00, 0x39, 0x03, 0x66, 0xff, 0x30, 0x05, 0x00, 0xfd, 0x5d, 0x66, 0x61, 0x0c, 0x00, 0x03, 0x66, 0x06, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xff, 0x47, 0x03, 0x66, 0xff, 0x30, 0x04, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x06, 0x0b, 0x00, 0xff, 0x5d, 0x02, 0x66, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x06, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x02, 0x00, 0xfe, 0x02, 0x52, 0x03, 0x66, 0xff, 0x30, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x39, 0x05, 0x00, 0xfd, 0x23, 0x41, 0x06, 0x03, 0x00, 0xff, 0x47, 0x02, 0x66, 0xff, 0x23, 0x03, 0x00, 0xfe, 0x02, 0x47, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x06, 0x5a, 0x04, 0x66, 0x02, 0x00, 0xfe, 0x06, 0x5d, 0x02, 0x66, 0xfb, 0x5a, 0x41, 0x39, 0x47, 0x5d, 0x02, 0x66, 0xff, 0x39, 0x03, 0x00, 0xff, 0x30, 0x02, 0x66, 0xff, 0x61, 0x02, 0x41, 0xfe, 0x47, 0x5a, 0x04, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x04, 0x00, 0xfe, 0x0b, 0x5d, 0x03, 0x66, 0x03, 0x00, 0xfe, 0x15, 0x61, 0x08, 0x66, 0xff, 0x41, 0x03, 0x00, 0xfe, 0x02, 0x52, 0x06, 0x66, 0xff, 0x39, 0x03, 0x66, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x66, 0x05, 0x00, 0xfe, 0x15, 0x61, 0x02, 0x66, 0x04, 0x00, 0xf7, 0x0b, 0x41, 0x5a, 0x66, 0x61, 0x5d, 0x47, 0x39, 0x15, 0x05, 0x00, 0xf8, 0x0b, 0x41, 0x5d, 0x64, 0x5d, 0x52, 0x23, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x66, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x5a, 0x02, 0x66, 0xff, 0x64, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x66, 0xff, 0x52, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x47, 0x61, 0x5d, 0x23, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00
+};
+static const Image screensaver_15_image = {image_data_screensaver_15, 256, 64};
+
+static const uint8_t image_data_screensaver_16[1354] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x05, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x03, 0x00, 0xf4, 0x37, 0x4a, 0x46, 0x1c, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfe, 0x3e, 0x02, 0x02, 0x00, 0x03, 0x4d, 0x02, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xff, 0x46, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xf9, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x00, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xfd, 0x1c, 0x00, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xfd, 0x2a, 0x00, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xfe, 0x32, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x02, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0b, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x08, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0a, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xff, 0x1c, 0x03, 0x4d, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x02, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0x03, 0x4d, 0xfa, 0x32, 0x11, 0x02, 0x00, 0x11, 0x43, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x0b, 0x4d, 0xff, 0x37, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0x03, 0x4d, 0xff, 0x43, 0x06, 0x4d, 0xfe, 0x43, 0x08, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x04, 0x00, 0x03, 0x4d, 0xf8, 0x04, 0x2a, 0x43, 0x4d, 0x4a, 0x3e, 0x25, 0x04, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x28, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xfd, 0x04, 0x2a, 0x43, 0x02, 0x4d, 0xfc, 0x4a, 0x43, 0x25, 0x02, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x08, 0x43, 0x07, 0x4d, 0xfd, 0x3e, 0x02, 0x00, 0x05, 0x4d, 0x04, 0x00, 0x05, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x03, 0x00, 0xff, 0x3e, 0x03, 0x4d, 0xfc, 0x37, 0x2e, 0x32, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x02, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x1c, 0x02, 0x4d, 0xfe, 0x4a, 0x11, 0x03, 0x00, 0xfb, 0x08, 0x4a, 0x4d, 0x4a, 0x04, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x32, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xff, 0x2e, 0x02, 0x4d, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xff, 0x43, 0x02, 0x4d, 0xff, 0x11, 0x05, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x4d, 0xff, 0x25, 0x06, 0x00, 0x0c, 0x4d, 0xff, 0x32, 0x02, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0xfe, 0x00, 0x2e, 0x03, 0x4d, 0xff, 0x25, 0x05, 0x00, 0xfd, 0x46, 0x4d, 0x4a, 0x0c, 0x00, 0x03, 0x4d, 0x06, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xff, 0x37, 0x03, 0x4d, 0xff, 0x25, 0x04, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x04, 0x0b, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x08, 0x04, 0x00, 0xff, 0x04, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x02, 0x00, 0xfe, 0x02, 0x3e, 0x03, 0x4d, 0xff, 0x25, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x2a, 0x05, 0x00, 0xfd, 0x1c, 0x2e, 0x04, 0x03, 0x00, 0xff, 0x37, 0x02, 0x4d, 0xff, 0x1c, 0x03, 0x00, 0xfe, 0x02, 0x37, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x04, 0x43, 0x04, 0x4d, 0x02, 0x00, 0xfe, 0x04, 0x46, 0x02, 0x4d, 0xfb, 0x43, 0x32, 0x2e, 0x37, 0x46, 0x02, 0x4d, 0xff, 0x2a, 0x03, 0x00, 0xff, 0x25, 0x02, 0x4d, 0xff, 0x4a, 0x02, 0x2e, 0xfe, 0x32, 0x46, 0x04, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x04, 0x00, 0xfe, 0x08, 0x46, 0x03, 0x4d, 0x03, 0x00, 0xfe, 0x11, 0x4a, 0x08, 0x4d, 0xff, 0x2e, 0x03, 0x00, 0xfe, 0x02, 0x3e, 0x06, 0x4d, 0xff, 0x2e, 0x03, 0x4d, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x4d, 0x05, 0x00, 0xfe, 0x11, 0x4a, 0x02, 0x4d, 0x04, 0x00, 0xf7, 0x08, 0x2e, 0x46, 0x4d, 0x4a, 0x46, 0x37, 0x2a, 0x11, 0x05, 0x00, 0xf8, 0x08, 0x2e, 0x46, 0x4d, 0x46, 0x3e, 0x1c, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x4d, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x46, 0x02, 0x4d, 0xff, 0x4a, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0xff, 0x3e, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x37, 0x4a, 0x46, 0x1c, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3e, 0x00
+};
+static const Image screensaver_16_image = {image_data_screensaver_16, 256, 64};
+
+static const uint8_t image_data_screensaver_17[1357] =
+{
+    0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x47, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x05, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x03, 0x00, 0xf9, 0x25, 0x31, 0x2e, 0x0d, 0x03, 0x1c, 0x2c, 0x02, 0x31, 0xfd, 0x25, 0x19, 0x01, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x03, 0x33, 0x02, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x2e, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xf9, 0x07, 0x31, 0x33, 0x31, 0x03, 0x00, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xfd, 0x14, 0x00, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x14, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xfd, 0x1c, 0x00, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xfe, 0x21, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x01, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0b, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0a, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0x03, 0x33, 0x05, 0x00, 0xff, 0x0d, 0x03, 0x33, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x02, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0x03, 0x33, 0xfe, 0x21, 0x0d, 0x02, 0x01, 0xfe, 0x07, 0x2c, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x0b, 0x33, 0xff, 0x25, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x06, 0x33, 0xfe, 0x2c, 0x07, 0x7f, 0x00, 0x4a, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x04, 0x00, 0x03, 0x33, 0xf8, 0x03, 0x1c, 0x2c, 0x33, 0x31, 0x25, 0x19, 0x03, 0x7f, 0x00, 0x4b, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x28, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xfd, 0x03, 0x1c, 0x2c, 0x02, 0x33, 0xfc, 0x31, 0x2c, 0x19, 0x01, 0x02, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x07, 0x2c, 0x07, 0x33, 0xfd, 0x25, 0x01, 0x00, 0x05, 0x33, 0x04, 0x00, 0x05, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x03, 0x00, 0xff, 0x29, 0x03, 0x33, 0xfc, 0x25, 0x1e, 0x21, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x02, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x53, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xfe, 0x31, 0x0d, 0x03, 0x00, 0xfb, 0x07, 0x31, 0x33, 0x31, 0x03, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x21, 0x02, 0x33, 0xff, 0x14, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x08, 0x33, 0xff, 0x19, 0x05, 0x00, 0xff, 0x2c, 0x02, 0x33, 0xff, 0x07, 0x05, 0x00, 0xff, 0x19, 0x02, 0x33, 0xff, 0x1c, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x07, 0x33, 0xff, 0x19, 0x06, 0x00, 0x0c, 0x33, 0xff, 0x21, 0x02, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfe, 0x00, 0x1e, 0x03, 0x33, 0xff, 0x19, 0x05, 0x00, 0xfd, 0x2e, 0x33, 0x31, 0x0c, 0x00, 0x03, 0x33, 0x06, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0xfd, 0x00, 0x01, 0x25, 0x03, 0x33, 0xff, 0x19, 0x04, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x03, 0x0b, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x07, 0x04, 0x00, 0xff, 0x03, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x29, 0x03, 0x33, 0xff, 0x19, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x1c, 0x05, 0x00, 0xfd, 0x14, 0x1e, 0x03, 0x03, 0x00, 0xff, 0x25, 0x02, 0x33, 0xff, 0x14, 0x03, 0x00, 0xfe, 0x01, 0x25, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x03, 0x2c, 0x04, 0x33, 0x02, 0x00, 0xfe, 0x01, 0x2e, 0x02, 0x33, 0xfb, 0x2c, 0x21, 0x1e, 0x25, 0x2e, 0x02, 0x33, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x14, 0x02, 0x33, 0xff, 0x31, 0x02, 0x1e, 0xfe, 0x25, 0x2c, 0x04, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x04, 0x00, 0xfe, 0x07, 0x2e, 0x03, 0x33, 0x03, 0x00, 0xfe, 0x0d, 0x31, 0x08, 0x33, 0xff, 0x1e, 0x03, 0x00, 0xfe, 0x01, 0x29, 0x06, 0x33, 0xff, 0x1e, 0x03, 0x33, 0x7f, 0x00, 0x58, 0x00, 0x03, 0x33, 0x05, 0x00, 0xfe, 0x0d, 0x31, 0x02, 0x33, 0x04, 0x00, 0xf7, 0x07, 0x1e, 0x2e, 0x33, 0x31, 0x2e, 0x25, 0x1c, 0x0d, 0x05, 0x00, 0xf8, 0x03, 0x1e, 0x2e, 0x33, 0x2e, 0x25, 0x14, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7e, 0x00, 0x03, 0x33, 0x7f, 0x00, 0x7d, 0x00, 0xff, 0x2e, 0x02, 0x33, 0xff, 0x31, 0x7f, 0x00, 0x7d, 0x00, 0x03, 0x33, 0xff, 0x2c, 0x7f, 0x00, 0x7d, 0x00, 0xfc, 0x25, 0x31, 0x2e, 0x0d, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x34, 0x00
+};
+static const Image screensaver_17_image = {image_data_screensaver_17, 256, 64};
 
 static const AnimationFrame screensaver_array[] =
 {
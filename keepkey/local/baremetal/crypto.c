@@ -28,9 +28,99 @@
 #include <nist256p1.h>
 #include <bip32.h>
 #include <layout.h>
+#include <trace.h>
 
 #include "crypto.h"
 
+/* === Private Variables =================================================== */
+
+typedef struct
+{
+	bool used;
+	uint8_t key[32];
+	bool has_descriptor;
+	MultisigDescriptor descriptor;
+	bool has_fingerprint;
+	uint8_t fingerprint[32];
+} MultisigCacheEntry;
+
+static MultisigCacheEntry multisig_cache[MULTISIG_CACHE_ENTRIES];
+static uint32_t multisig_cache_next;
+
+/* === Private Functions =================================================== */
+
+/*
+ * multisig_cache_key() - Hashes the fields of a multisig redeem script that
+ * determine its compiled form (signatures are excluded)
+ *
+ * INPUT
+ *     - multisig: multisig redeem script
+ *     - key: buffer for the 32 byte cache key
+ * OUTPUT
+ *     none
+ *
+ */
+static void multisig_cache_key(const MultisigRedeemScriptType *multisig, uint8_t *key)
+{
+	SHA256_CTX ctx;
+	uint32_t i, j, v;
+
+	sha256_Init(&ctx);
+	v = multisig->has_m ? multisig->m : 0;
+	sha256_Update(&ctx, (const uint8_t *)&v, sizeof(uint32_t));
+	v = multisig->pubkeys_count;
+	sha256_Update(&ctx, (const uint8_t *)&v, sizeof(uint32_t));
+	for (i = 0; i < multisig->pubkeys_count && i < MULTISIG_MAX_PUBKEYS; i++) {
+		const HDNodePathType *path = &(multisig->pubkeys[i]);
+		sha256_Update(&ctx, (const uint8_t *)&(path->node.depth), sizeof(uint32_t));
+		sha256_Update(&ctx, (const uint8_t *)&(path->node.fingerprint), sizeof(uint32_t));
+		sha256_Update(&ctx, (const uint8_t *)&(path->node.child_num), sizeof(uint32_t));
+		v = path->node.chain_code.size;
+		sha256_Update(&ctx, (const uint8_t *)&v, sizeof(uint32_t));
+		sha256_Update(&ctx, path->node.chain_code.bytes, path->node.chain_code.size);
+		v = path->node.has_public_key ? path->node.public_key.size : 0xFFFFFFFF;
+		sha256_Update(&ctx, (const uint8_t *)&v, sizeof(uint32_t));
+		sha256_Update(&ctx, path->node.public_key.bytes, path->node.public_key.size);
+		v = path->address_n_count;
+		sha256_Update(&ctx, (const uint8_t *)&v, sizeof(uint32_t));
+		for (j = 0; j < path->address_n_count; j++) {
+			sha256_Update(&ctx, (const uint8_t *)&(path->address_n[j]), sizeof(uint32_t));
+		}
+	}
+	sha256_Final(key, &ctx);
+}
+
+/*
+ * multisig_cache_entry() - Finds the cache entry for a multisig redeem script,
+ * recycling the oldest entry when it is not cached yet
+ *
+ * INPUT
+ *     - multisig: multisig redeem script
+ * OUTPUT
+ *     cache entry for the script
+ *
+ */
+static MultisigCacheEntry *multisig_cache_entry(const MultisigRedeemScriptType *multisig)
+{
+	uint8_t key[32];
+	MultisigCacheEntry *entry;
+	uint32_t i;
+
+	multisig_cache_key(multisig, key);
+	for (i = 0; i < MULTISIG_CACHE_ENTRIES; i++) {
+		if (multisig_cache[i].used && memcmp(multisig_cache[i].key, key, 32) == 0) {
+			return &multisig_cache[i];
+		}
+	}
+
+	entry = &multisig_cache[multisig_cache_next];
+	multisig_cache_next = (multisig_cache_next + 1) % MULTISIG_CACHE_ENTRIES;
+	memset(entry, 0, sizeof(MultisigCacheEntry));
+	entry->used = true;
+	memcpy(entry->key, key, 32);
+	return entry;
+}
+
 /* === Functions =========================================================== */
 
 uint32_t ser_length(uint32_t len, uint8_t *out)
@@ -53,6 +143,17 @@ uint32_t ser_length(uint32_t len, uint8_t *out)
 	return 5;
 }
 
+uint32_t ser_length_size(uint32_t len)
+{
+	if (len < 253) {
+		return 1;
+	}
+	if (len < 0x10000) {
+		return 3;
+	}
+	return 5;
+}
+
 uint32_t ser_length_hash(SHA256_CTX *ctx, uint32_t len)
 {
 	if (len < 253) {
@@ -108,7 +209,9 @@ int cryptoMessageSign(const uint8_t *message, size_t message_len, const uint8_t
 	sha256_Final(hash, &ctx);
 	sha256_Raw(hash, 32, hash);
 	uint8_t pby;
+	TRACE_START(start);
 	int result = ecdsa_sign_digest(&secp256k1, privkey, hash, signature + 1, &pby);
+	TRACE_PHASE(TRACE_PHASE_SIGN, start);
 	if (result == 0) {
 		signature[0] = 27 + pby + 4;
 	}
@@ -303,10 +406,13 @@ uint8_t *cryptoHDNodePathToPubkey(const HDNodePathType *hdnodepath)
 
 int cryptoMultisigPubkeyIndex(const MultisigRedeemScriptType *multisig, const uint8_t *pubkey)
 {
-	size_t i;
-	for (i = 0; i < multisig->pubkeys_count; i++) {
-		const uint8_t *node_pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
-		if (node_pubkey && memcmp(node_pubkey, pubkey, 33) == 0) {
+	const MultisigDescriptor *descriptor = cryptoMultisigDescriptor(multisig);
+	if (!descriptor) {
+		return -1;
+	}
+	uint32_t i;
+	for (i = 0; i < descriptor->pubkeys_count; i++) {
+		if (memcmp(descriptor->pubkeys[i], pubkey, 33) == 0) {
 			return i;
 		}
 	}
@@ -315,14 +421,19 @@ int cryptoMultisigPubkeyIndex(const MultisigRedeemScriptType *multisig, const ui
 
 int cryptoMultisigFingerprint(const MultisigRedeemScriptType *multisig, uint8_t *hash)
 {
-	static const HDNodePathType *ptr[15], *swap;
+	static const HDNodePathType *ptr[MULTISIG_MAX_PUBKEYS], *swap;
 	const uint32_t n = multisig->pubkeys_count;
-	if (n > 15) {
+	if (n > MULTISIG_MAX_PUBKEYS) {
 		return 0;
 	}
 	uint32_t i, j;
 	// check sanity
 	if (!multisig->has_m || multisig->m < 1 || multisig->m > 15) return 0;
+	MultisigCacheEntry *entry = multisig_cache_entry(multisig);
+	if (entry->has_fingerprint) {
+		memcpy(hash, entry->fingerprint, 32);
+		return 1;
+	}
 	for (i = 0; i < n; i++) {
 		ptr[i] = &(multisig->pubkeys[i]);
 		if (!ptr[i]->node.has_public_key || ptr[i]->node.public_key.size != 33) return 0;
@@ -351,10 +462,75 @@ int cryptoMultisigFingerprint(const MultisigRedeemScriptType *multisig, uint8_t
 	}
 	sha256_Update(&ctx, (const uint8_t *)&n, sizeof(uint32_t));
 	sha256_Final(hash, &ctx);
+	memcpy(entry->fingerprint, hash, 32);
+	entry->has_fingerprint = true;
 	animating_progress_handler();
 	return 1;
 }
 
+/*
+ * cryptoMultisigDescriptor() - Derives the cosigner pubkeys and redeem script
+ * hash of a multisig script, reusing the result for scripts seen earlier in
+ * the signing session
+ *
+ * INPUT
+ *     - multisig: multisig redeem script
+ * OUTPUT
+ *     compiled multisig descriptor, or NULL on invalid script
+ *
+ */
+const MultisigDescriptor *cryptoMultisigDescriptor(const MultisigRedeemScriptType *multisig)
+{
+	if (!multisig->has_m) return 0;
+	const uint32_t m = multisig->m;
+	const uint32_t n = multisig->pubkeys_count;
+	if (m < 1 || m > 15) return 0;
+	if (n < 1 || n > MULTISIG_MAX_PUBKEYS) return 0;
+
+	MultisigCacheEntry *entry = multisig_cache_entry(multisig);
+	if (entry->has_descriptor) {
+		return &(entry->descriptor);
+	}
+
+	MultisigDescriptor *descriptor = &(entry->descriptor);
+	SHA256_CTX ctx;
+	uint8_t d[2];
+	uint32_t i;
+
+	sha256_Init(&ctx);
+	d[0] = 0x50 + m; sha256_Update(&ctx, d, 1);
+	for (i = 0; i < n; i++) {
+		const uint8_t *pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
+		if (!pubkey) return 0;
+		memcpy(descriptor->pubkeys[i], pubkey, 33);
+		d[0] = 33; sha256_Update(&ctx, d, 1); // OP_PUSH 33
+		sha256_Update(&ctx, pubkey, 33);
+	}
+	d[0] = 0x50 + n;
+	d[1] = 0xAE;
+	sha256_Update(&ctx, d, 2);
+	sha256_Final(descriptor->script_hash, &ctx);
+
+	descriptor->pubkeys_count = n;
+	entry->has_descriptor = true;
+	return descriptor;
+}
+
+/*
+ * cryptoMultisigCacheClear() - Drops all cached multisig descriptors
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+void cryptoMultisigCacheClear(void)
+{
+	memset(multisig_cache, 0, sizeof(multisig_cache));
+	multisig_cache_next = 0;
+}
+
 int cryptoIdentityFingerprint(const IdentityType *identity, uint8_t *hash)
 {
 	SHA256_CTX ctx;
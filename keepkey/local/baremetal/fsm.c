@@ -37,6 +37,7 @@
 #include <memory.h>
 #include <resources.h>
 #include <timer.h>
+#include <trace.h>
 #include <keepkey_board.h>
 #include <keepkey_flash.h>
 
@@ -58,73 +59,73 @@
 
 /* === Private Variables =================================================== */
 
-static uint8_t msg_resp[MAX_FRAME_SIZE];
-
 static const MessagesMap_t MessagesMap[] =
 {
     /* Normal Messages */
-    MSG_IN(MessageType_MessageType_Initialize,          Initialize_fields, (void (*)(void *))fsm_msgInitialize)
-    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures_fields, (void (*)(void *))fsm_msgGetFeatures)
-    MSG_IN(MessageType_MessageType_Ping,                Ping_fields, (void (*)(void *))fsm_msgPing)
-    MSG_IN(MessageType_MessageType_ChangePin,           ChangePin_fields, (void (*)(void *))fsm_msgChangePin)
-    MSG_IN(MessageType_MessageType_WipeDevice,          WipeDevice_fields, (void (*)(void *))fsm_msgWipeDevice)
-    MSG_IN(MessageType_MessageType_FirmwareErase,       FirmwareErase_fields, (void (*)(void *))fsm_msgFirmwareErase)
-    MSG_IN(MessageType_MessageType_FirmwareUpload,      FirmwareUpload_fields, (void (*)(void *))fsm_msgFirmwareUpload)
-    MSG_IN(MessageType_MessageType_GetEntropy,          GetEntropy_fields, (void (*)(void *))fsm_msgGetEntropy)
-    MSG_IN(MessageType_MessageType_GetPublicKey,        GetPublicKey_fields, (void (*)(void *))fsm_msgGetPublicKey)
-    MSG_IN(MessageType_MessageType_LoadDevice,          LoadDevice_fields, (void (*)(void *))fsm_msgLoadDevice)
-    MSG_IN(MessageType_MessageType_ResetDevice,         ResetDevice_fields, (void (*)(void *))fsm_msgResetDevice)
-    MSG_IN(MessageType_MessageType_SignTx,              SignTx_fields, (void (*)(void *))fsm_msgSignTx)
-    MSG_IN(MessageType_MessageType_PinMatrixAck,        PinMatrixAck_fields,        NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_Cancel,              Cancel_fields, (void (*)(void *))fsm_msgCancel)
-    MSG_IN(MessageType_MessageType_TxAck,               TxAck_fields, (void (*)(void *))fsm_msgTxAck)
-    MSG_IN(MessageType_MessageType_CipherKeyValue,      CipherKeyValue_fields, (void (*)(void *))fsm_msgCipherKeyValue)
-    MSG_IN(MessageType_MessageType_ClearSession,        ClearSession_fields, (void (*)(void *))fsm_msgClearSession)
-    MSG_IN(MessageType_MessageType_ApplySettings,       ApplySettings_fields, (void (*)(void *))fsm_msgApplySettings)
-    MSG_IN(MessageType_MessageType_ButtonAck,           ButtonAck_fields,           NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_GetAddress,          GetAddress_fields, (void (*)(void *))fsm_msgGetAddress)
-    MSG_IN(MessageType_MessageType_EntropyAck,          EntropyAck_fields, (void (*)(void *))fsm_msgEntropyAck)
-    MSG_IN(MessageType_MessageType_SignMessage,         SignMessage_fields, (void (*)(void *))fsm_msgSignMessage)
-    MSG_IN(MessageType_MessageType_SignIdentity,        SignIdentity_fields, (void (*)(void *))fsm_msgSignIdentity)
-    MSG_IN(MessageType_MessageType_VerifyMessage,       VerifyMessage_fields, (void (*)(void *))fsm_msgVerifyMessage)
-    MSG_IN(MessageType_MessageType_EncryptMessage,      EncryptMessage_fields, (void (*)(void *))fsm_msgEncryptMessage)
-    MSG_IN(MessageType_MessageType_DecryptMessage,      DecryptMessage_fields, (void (*)(void *))fsm_msgDecryptMessage)
-    MSG_IN(MessageType_MessageType_PassphraseAck,       PassphraseAck_fields,       NO_PROCESS_FUNC)
-    MSG_IN(MessageType_MessageType_EstimateTxSize,      EstimateTxSize_fields, (void (*)(void *))fsm_msgEstimateTxSize)
-    MSG_IN(MessageType_MessageType_RecoveryDevice,      RecoveryDevice_fields, (void (*)(void *))fsm_msgRecoveryDevice)
-    MSG_IN(MessageType_MessageType_WordAck,             WordAck_fields, (void (*)(void *))fsm_msgWordAck)
-    MSG_IN(MessageType_MessageType_CharacterAck,        CharacterAck_fields, (void (*)(void *))fsm_msgCharacterAck)
+    MSG_IN(MessageType_MessageType_Initialize,          Initialize, (void (*)(void *))fsm_msgInitialize)
+    MSG_IN(MessageType_MessageType_GetFeatures,         GetFeatures, (void (*)(void *))fsm_msgGetFeatures)
+    MSG_IN(MessageType_MessageType_Ping,                Ping, (void (*)(void *))fsm_msgPing)
+    MSG_IN(MessageType_MessageType_ChangePin,           ChangePin, (void (*)(void *))fsm_msgChangePin)
+    MSG_IN(MessageType_MessageType_WipeDevice,          WipeDevice, (void (*)(void *))fsm_msgWipeDevice)
+    MSG_IN(MessageType_MessageType_FirmwareErase,       FirmwareErase, (void (*)(void *))fsm_msgFirmwareErase)
+    MSG_IN(MessageType_MessageType_FirmwareUpload,      FirmwareUpload, (void (*)(void *))fsm_msgFirmwareUpload)
+    MSG_IN(MessageType_MessageType_GetEntropy,          GetEntropy, (void (*)(void *))fsm_msgGetEntropy)
+    MSG_IN(MessageType_MessageType_GetPublicKey,        GetPublicKey, (void (*)(void *))fsm_msgGetPublicKey)
+    MSG_IN(MessageType_MessageType_LoadDevice,          LoadDevice, (void (*)(void *))fsm_msgLoadDevice)
+    MSG_IN(MessageType_MessageType_ResetDevice,         ResetDevice, (void (*)(void *))fsm_msgResetDevice)
+    MSG_IN(MessageType_MessageType_SignTx,              SignTx, (void (*)(void *))fsm_msgSignTx)
+    MSG_IN(MessageType_MessageType_PinMatrixAck,        PinMatrixAck,               NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_Cancel,              Cancel, (void (*)(void *))fsm_msgCancel)
+    MSG_IN(MessageType_MessageType_TxAck,               TxAck, (void (*)(void *))fsm_msgTxAck)
+    MSG_IN(MessageType_MessageType_CipherKeyValue,      CipherKeyValue, (void (*)(void *))fsm_msgCipherKeyValue)
+    MSG_IN(MessageType_MessageType_ClearSession,        ClearSession, (void (*)(void *))fsm_msgClearSession)
+    MSG_IN(MessageType_MessageType_ApplySettings,       ApplySettings, (void (*)(void *))fsm_msgApplySettings)
+    MSG_IN(MessageType_MessageType_ButtonAck,           ButtonAck,                  NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_GetAddress,          GetAddress, (void (*)(void *))fsm_msgGetAddress)
+    MSG_IN(MessageType_MessageType_EntropyAck,          EntropyAck, (void (*)(void *))fsm_msgEntropyAck)
+    MSG_IN(MessageType_MessageType_SignMessage,         SignMessage, (void (*)(void *))fsm_msgSignMessage)
+    MSG_IN(MessageType_MessageType_SignIdentity,        SignIdentity, (void (*)(void *))fsm_msgSignIdentity)
+    MSG_IN(MessageType_MessageType_VerifyMessage,       VerifyMessage, (void (*)(void *))fsm_msgVerifyMessage)
+    MSG_IN(MessageType_MessageType_EncryptMessage,      EncryptMessage, (void (*)(void *))fsm_msgEncryptMessage)
+    MSG_IN(MessageType_MessageType_DecryptMessage,      DecryptMessage, (void (*)(void *))fsm_msgDecryptMessage)
+    MSG_IN(MessageType_MessageType_PassphraseAck,       PassphraseAck,              NO_PROCESS_FUNC)
+    MSG_IN(MessageType_MessageType_EstimateTxSize,      EstimateTxSize, (void (*)(void *))fsm_msgEstimateTxSize)
+    MSG_IN(MessageType_MessageType_RecoveryDevice,      RecoveryDevice, (void (*)(void *))fsm_msgRecoveryDevice)
+    MSG_IN(MessageType_MessageType_WordAck,             WordAck, (void (*)(void *))fsm_msgWordAck)
+    MSG_IN(MessageType_MessageType_CharacterAck,        CharacterAck, (void (*)(void *))fsm_msgCharacterAck)
 
     /* Normal Out Messages */
-    MSG_OUT(MessageType_MessageType_Success,            Success_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Failure,            Failure_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Entropy,            Entropy_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_PublicKey,          PublicKey_fields,           NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Features,           Features_fields,            NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_PinMatrixRequest,   PinMatrixRequest_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_TxRequest,          TxRequest_fields,           NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_CipheredKeyValue,   CipheredKeyValue_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_ButtonRequest,      ButtonRequest_fields,       NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_Address,            Address_fields,             NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_EntropyRequest,     EntropyRequest_fields,      NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_MessageSignature,   MessageSignature_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_SignedIdentity,     SignedIdentity_fields,      NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_EncryptedMessage,   EncryptedMessage_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_DecryptedMessage,   DecryptedMessage_fields,    NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_PassphraseRequest,  PassphraseRequest_fields,   NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_TxSize,             TxSize_fields,              NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_WordRequest,        WordRequest_fields,         NO_PROCESS_FUNC)
-    MSG_OUT(MessageType_MessageType_CharacterRequest,   CharacterRequest_fields,    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Success,            Success,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Failure,            Failure,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Entropy,            Entropy,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PublicKey,          PublicKey,                  NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Features,           Features,                   NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PinMatrixRequest,   PinMatrixRequest,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_TxRequest,          TxRequest,                  NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_CipheredKeyValue,   CipheredKeyValue,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_ButtonRequest,      ButtonRequest,              NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_Address,            Address,                    NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EntropyRequest,     EntropyRequest,             NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_MessageSignature,   MessageSignature,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_SignedIdentity,     SignedIdentity,             NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_EncryptedMessage,   EncryptedMessage,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_DecryptedMessage,   DecryptedMessage,           NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_PassphraseRequest,  PassphraseRequest,          NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_TxSize,             TxSize,                     NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_WordRequest,        WordRequest,                NO_PROCESS_FUNC)
+    MSG_OUT(MessageType_MessageType_CharacterRequest,   CharacterRequest,           NO_PROCESS_FUNC)
 
 #if DEBUG_LINK
     /* Debug Messages */
-    DEBUG_IN(MessageType_MessageType_DebugLinkDecision, DebugLinkDecision_fields,   NO_PROCESS_FUNC)
-    DEBUG_IN(MessageType_MessageType_DebugLinkGetState, DebugLinkGetState_fields, (void (*)(void *))fsm_msgDebugLinkGetState)
-    DEBUG_IN(MessageType_MessageType_DebugLinkStop,     DebugLinkStop_fields, (void (*)(void *))fsm_msgDebugLinkStop)
+    DEBUG_IN(MessageType_MessageType_DebugLinkDecision, DebugLinkDecision,          NO_PROCESS_FUNC)
+    DEBUG_IN(MessageType_MessageType_DebugLinkGetState, DebugLinkGetState, (void (*)(void *))fsm_msgDebugLinkGetState)
+    DEBUG_IN(MessageType_MessageType_DebugLinkStop,     DebugLinkStop, (void (*)(void *))fsm_msgDebugLinkStop)
+    DEBUG_IN((MessageType)StatsMessageType_MessageType_DebugLinkGetStats, DebugLinkGetStats, (void (*)(void *))fsm_msgDebugLinkGetStats)
 
     /* Debug Out Messages */
-    DEBUG_OUT(MessageType_MessageType_DebugLinkState, DebugLinkState_fields,        NO_PROCESS_FUNC)
-    DEBUG_OUT(MessageType_MessageType_DebugLinkLog, DebugLinkLog_fields,            NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkState, DebugLinkState,               NO_PROCESS_FUNC)
+    DEBUG_OUT(MessageType_MessageType_DebugLinkLog, DebugLinkLog,                   NO_PROCESS_FUNC)
+    DEBUG_OUT((MessageType)StatsMessageType_MessageType_DebugLinkStats, DebugLinkStats, NO_PROCESS_FUNC)
 #endif
 };
 
@@ -210,21 +211,55 @@ const CoinType *fsm_getCoin(const char *name)
 const HDNode *fsm_getDerivedNode(uint32_t *address_n, size_t address_n_count)
 {
     static HDNode node;
+    size_t i;
+    int derived = 1;
 
-    if(!storage_get_root_node(&node))
+    /* Account node from the persistent cache skips the hardened derivations */
+    if(address_n && address_n_count >= ACCOUNT_CACHE_DEPTH &&
+            storage_get_account_node(address_n, &node))
     {
-        fsm_sendFailure(FailureType_Failure_NotInitialized,
-                        "Device not initialized or passphrase request cancelled");
-        go_home();
-        return 0;
+        address_n += ACCOUNT_CACHE_DEPTH;
+        address_n_count -= ACCOUNT_CACHE_DEPTH;
+    }
+    else
+    {
+        if(!storage_get_root_node(&node))
+        {
+            fsm_sendFailure(FailureType_Failure_NotInitialized,
+                            "Device not initialized or passphrase request cancelled");
+            go_home();
+            return 0;
+        }
+
+        if(address_n && address_n_count >= ACCOUNT_CACHE_DEPTH &&
+                storage_account_node_cacheable(address_n))
+        {
+            TRACE_START(account_start);
+
+            for(i = 0; i < ACCOUNT_CACHE_DEPTH && derived; i++)
+            {
+                derived = hdnode_private_ckd(&node, address_n[i]);
+            }
+
+            TRACE_PHASE(TRACE_PHASE_DERIVE, account_start);
+
+            if(derived)
+            {
+                storage_set_account_node(address_n, &node);
+                address_n += ACCOUNT_CACHE_DEPTH;
+                address_n_count -= ACCOUNT_CACHE_DEPTH;
+            }
+        }
     }
 
-    if(!address_n || address_n_count == 0)
+    if(derived && address_n && address_n_count > 0)
     {
-        return &node;
+        TRACE_START(start);
+        derived = hdnode_private_ckd_cached(&node, address_n, address_n_count);
+        TRACE_PHASE(TRACE_PHASE_DERIVE, start);
     }
 
-    if(hdnode_private_ckd_cached(&node, address_n, address_n_count) == 0)
+    if(derived == 0)
     {
         fsm_sendFailure(FailureType_Failure_Other, "Failed to derive private key");
         go_home();
@@ -522,7 +557,9 @@ void fsm_msgGetPublicKey(GetPublicKey *msg)
     resp->node.public_key.size = 33;
     memcpy(resp->node.public_key.bytes, public_key, 33);
     resp->has_xpub = true;
+    TRACE_START(start);
     hdnode_serialize_public(node, resp->xpub, sizeof(resp->xpub));
+    TRACE_PHASE(TRACE_PHASE_SERIALIZE, start);
 
     if(msg->has_show_display && msg->show_display)
     {
@@ -854,6 +891,8 @@ void fsm_msgGetAddress(GetAddress *msg)
 
     if(!node) { return; }
 
+    TRACE_START(start);
+
     if(msg->has_multisig)
     {
 
@@ -884,6 +923,8 @@ void fsm_msgGetAddress(GetAddress *msg)
                           sizeof(resp->address));
     }
 
+    TRACE_PHASE(TRACE_PHASE_SERIALIZE, start);
+
     if(msg->has_show_display && msg->show_display)
     {
         char desc[MEDIUM_STR_BUF] = "";
@@ -1439,4 +1480,104 @@ void fsm_msgDebugLinkStop(DebugLinkStop *msg)
 {
     (void)msg;
 }
+
+#if MSG_TRACE
+/*
+ * fill_stats() - Copy collected trace stats into protocol buffer message
+ *
+ * INPUT
+ *     - dst: message stats to fill
+ *     - src: collected trace stats
+ * OUTPUT
+ *     none
+ *
+ */
+static void fill_stats(MessageStatsType *dst, const TraceStats *src)
+{
+    dst->has_id = true;
+    dst->id = src->id;
+    dst->has_count = true;
+    dst->count = src->count;
+    dst->has_min_cycles = true;
+    dst->min_cycles = src->min;
+    dst->has_max_cycles = true;
+    dst->max_cycles = src->max;
+    dst->has_total_cycles = true;
+    dst->total_cycles = src->total;
+    dst->histogram_count = TRACE_HISTOGRAM_BUCKETS;
+    memcpy(dst->histogram, src->histogram, sizeof(dst->histogram));
+}
+#endif
+
+void fsm_msgDebugLinkGetStats(DebugLinkGetStats *msg)
+{
+    RESP_INIT(DebugLinkStats);
+
+    resp->has_arena_high_water = true;
+    resp->has_response_high_water = true;
+    msg_arena_high_water(&resp->arena_high_water, &resp->response_high_water);
+
+    const UsbTxStats *tx = usb_tx_stats();
+    resp->has_usb_tx_packets = true;
+    resp->usb_tx_packets = tx->packets;
+    resp->has_usb_tx_high_water = true;
+    resp->usb_tx_high_water = tx->high_water;
+    resp->has_usb_tx_full_waits = true;
+    resp->usb_tx_full_waits = tx->full_waits;
+
+#if MSG_TRACE
+    _Static_assert(TRACE_MAX_MESSAGES <= sizeof(resp->messages) / sizeof(resp->messages[0]),
+                   "DebugLinkStats.messages is too small");
+    _Static_assert(TRACE_PHASE_COUNT <= sizeof(resp->phases) / sizeof(resp->phases[0]),
+                   "DebugLinkStats.phases is too small");
+    _Static_assert(TRACE_HISTOGRAM_BUCKETS == sizeof(resp->messages[0].histogram) /
+                   sizeof(resp->messages[0].histogram[0]),
+                   "MessageStatsType.histogram size mismatch");
+
+    uint32_t i, count;
+    const TraceStats *stats = trace_message_stats(&count);
+
+    for(i = 0; i < count; i++)
+    {
+        fill_stats(&resp->messages[i], &stats[i]);
+    }
+
+    resp->messages_count = count;
+
+    stats = trace_phase_stats();
+
+    for(i = 0; i < TRACE_PHASE_COUNT; i++)
+    {
+        fill_stats(&resp->phases[i], &stats[i]);
+    }
+
+    resp->phases_count = TRACE_PHASE_COUNT;
+    resp->has_cycles_per_us = true;
+    resp->cycles_per_us = TRACE_CYCLES_PER_US;
+
+    const FlashWriteStats *flash = flash_write_stats();
+    resp->has_flash_write = true;
+    resp->flash_write.has_bytes = true;
+    resp->flash_write.bytes = flash->bytes;
+    resp->flash_write.has_head = true;
+    resp->flash_write.head = flash->head;
+    resp->flash_write.has_units = true;
+    resp->flash_write.units = flash->units;
+    resp->flash_write.has_tail = true;
+    resp->flash_write.tail = flash->tail;
+    resp->flash_write.has_unit_size = true;
+    resp->flash_write.unit_size = flash->unit_size;
+    resp->flash_write.has_cycles = true;
+    resp->flash_write.cycles = flash->cycles;
+
+    if(msg->has_reset && msg->reset)
+    {
+        trace_reset();
+    }
+#else
+    (void)msg;
+#endif
+
+    msg_debug_write((MessageType)StatsMessageType_MessageType_DebugLinkStats, resp);
+}
 #endif
@@ -27,6 +27,7 @@
 #include <rand.h>
 #include <storage.h>
 #include <timer.h>
+#include <trace.h>
 #include <stdio.h>
 
 #include "pin_sm.h"
@@ -238,6 +239,9 @@ static bool pin_request(const char *prompt, PINInfo *pin_info)
         {
             break;
         }
+
+        /* Sleep until there is USB traffic or an animation frame is due */
+        wait_for_event(EVENT_USB | EVENT_TIMER);
     }
 
     /* Check for PIN cancel */
@@ -355,14 +359,17 @@ bool pin_protect(char *prompt)
  */
 bool pin_protect_cached(void)
 {
-    if(session_is_pin_cached())
-    {
-        return (true);
-    }
-    else
+    bool ret = true;
+
+    TRACE_START(start);
+
+    if(!session_is_pin_cached())
     {
-        return (pin_protect("Enter Your PIN"));
+        ret = pin_protect("Enter Your PIN");
     }
+
+    TRACE_PHASE(TRACE_PHASE_PIN, start);
+    return (ret);
 }
 
 /*
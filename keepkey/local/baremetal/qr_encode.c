@@ -27,24 +27,32 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <limits.h>
 
 #include "qr_encode.h"
 #include "qr_consts.h"
 
+/* === Defines ============================================================= */
+
+// Symbols up to this size are scored from modules packed one bit per module
+#define QR_PACKED_MODULESIZE  64
+
 /* === Variables =========================================================== */
 
-int m_nLevel;
-int m_nVersion;
-int m_nMaskingNo;
-int m_ncDataCodeWordBit, m_ncAllCodeWord, nEncodeVersion;
-int m_ncDataBlock;
-int m_nSymbleSize;
-int m_nBlockLength[QR_MAX_DATACODEWORD];
-uint8_t m_byModuleData[QR_MAX_MODULESIZE][QR_MAX_MODULESIZE]; // [x][y]
-uint8_t m_byAllCodeWord[QR_MAX_ALLCODEWORD];
-uint8_t m_byBlockMode[QR_MAX_DATACODEWORD];
-uint8_t m_byDataCodeWord[QR_MAX_DATACODEWORD];
-uint8_t m_byRSWork[QR_MAX_CODEBLOCK];
+static int m_nLevel;
+static int m_nVersion;
+static int m_nMaskingNo;
+static int m_ncDataCodeWordBit, m_ncAllCodeWord, nEncodeVersion;
+static int m_ncDataBlock;
+static int m_nSymbleSize;
+static int m_nBlockLength[QR_MAX_DATACODEWORD];
+static uint8_t m_byModuleData[QR_MAX_MODULESIZE][QR_MAX_MODULESIZE]; // [x][y]
+static uint8_t m_byAllCodeWord[QR_MAX_ALLCODEWORD];
+static uint8_t m_byBlockMode[QR_MAX_DATACODEWORD];
+static uint8_t m_byDataCodeWord[QR_MAX_DATACODEWORD];
+static uint8_t m_byRSWork[QR_MAX_CODEBLOCK];
+static uint64_t m_qwDarkRow[QR_MAX_MODULESIZE]; // bit x set for dark module [x][y]
+static uint64_t m_qwDarkCol[QR_MAX_MODULESIZE]; // bit y set for dark module [x][y]
 
 /* === Functions =========================================================== */
 
@@ -754,6 +762,104 @@ void SetFormatInfoPattern(int nPatternNo)
 	}
 }
 
+// Penalty of same color runs of five or more modules in one line
+static int CountLinePenaltyRuns(uint64_t qwLine)
+{
+	int nPenalty = 0;
+	int nPrev = -1;
+
+	// Bit j is set where module j and j + 1 differ, the last module always ends a run
+	uint64_t qwEnds = ((qwLine ^ (qwLine >> 1)) & ((1ULL << (m_nSymbleSize - 1)) - 1)) | (1ULL << (m_nSymbleSize - 1));
+
+	while (qwEnds) {
+		int nEnd = __builtin_ctzll(qwEnds);
+
+		if (nEnd - nPrev >= 5) {
+			nPenalty += 3 + (nEnd - nPrev - 5);
+		}
+
+		nPrev = nEnd;
+		qwEnds &= qwEnds - 1;
+	}
+
+	return nPenalty;
+}
+
+// Penalty of 1:1:3:1:1 finder like patterns with four light modules before or after in one line
+static int CountLinePenaltyFinder(uint64_t qwLine)
+{
+	// Bit j of each term is module j + offset, modules outside the symbol are light
+	uint64_t qwPattern =  qwLine        & ~(qwLine >> 1) &  (qwLine >> 2) & (qwLine >> 3) &
+						 (qwLine >> 4)  & ~(qwLine >> 5) &  (qwLine >> 6) &
+						~(qwLine << 1)  & ~(qwLine >> 7);
+	uint64_t qwLightBefore = ~(qwLine << 2) & ~(qwLine << 3) & ~(qwLine << 4);
+	uint64_t qwLightAfter = ~(qwLine >> 8) & ~(qwLine >> 9) & ~(qwLine >> 10);
+
+	return 40 * __builtin_popcountll(qwPattern & (qwLightBefore | qwLightAfter));
+}
+
+// Same scoring as CountPenalty on packed modules, stops once nLimit is reached
+static int CountPenaltyPacked(int nLimit)
+{
+	int nPenalty = 0;
+	int nCount = 0;
+	int i;
+	uint64_t qwInner = (1ULL << (m_nSymbleSize - 1)) - 1;
+
+	memset(m_qwDarkRow, 0, sizeof(m_qwDarkRow));
+	memset(m_qwDarkCol, 0, sizeof(m_qwDarkCol));
+
+	for (i = 0; i < m_nSymbleSize; i++) {
+		int j;
+
+		for (j = 0; j < m_nSymbleSize; j++) {
+			if (m_byModuleData[i][j] & 0x11) {
+				m_qwDarkRow[j] |= 1ULL << i;
+				m_qwDarkCol[i] |= 1ULL << j;
+			}
+		}
+	}
+
+	// Adjacent modules of the same color in columns and lines
+	for (i = 0; i < m_nSymbleSize; i++) {
+		nPenalty += CountLinePenaltyRuns(m_qwDarkCol[i]) + CountLinePenaltyRuns(m_qwDarkRow[i]);
+	}
+
+	if (nPenalty >= nLimit) {
+		return nPenalty;
+	}
+
+	// Modules of the same color block (2 ~ 2)
+	for (i = 0; i < m_nSymbleSize - 1; i++) {
+		uint64_t a = m_qwDarkCol[i];
+		uint64_t b = m_qwDarkCol[i + 1];
+
+		nPenalty += 3 * __builtin_popcountll(~(a ^ (a >> 1)) & ~(a ^ b) & ~(a ^ (b >> 1)) & qwInner);
+	}
+
+	if (nPenalty >= nLimit) {
+		return nPenalty;
+	}
+
+	// Finder like patterns in columns and lines
+	for (i = 0; i < m_nSymbleSize; i++) {
+		nPenalty += CountLinePenaltyFinder(m_qwDarkCol[i]) + CountLinePenaltyFinder(m_qwDarkRow[i]);
+	}
+
+	if (nPenalty >= nLimit) {
+		return nPenalty;
+	}
+
+	// The proportion of modules for the entire dark, counted as light modules like CountPenalty
+	for (i = 0; i < m_nSymbleSize; i++) {
+		nCount += m_nSymbleSize - __builtin_popcountll(m_qwDarkRow[i]);
+	}
+
+	nPenalty += (abs(50 - ((nCount * 100) / (m_nSymbleSize * m_nSymbleSize))) / 5) * 10;
+
+	return nPenalty;
+}
+
 int CountPenalty(void)
 {
 	int nPenalty = 0;
@@ -900,13 +1006,15 @@ void FormatModule(void)
 		SetMaskingPattern(m_nMaskingNo); 		// Masking
 		SetFormatInfoPattern(m_nMaskingNo); 	// Placement pattern format information
 
-		int nMinPenalty = CountPenalty();
+		bool bPacked = (m_nSymbleSize <= QR_PACKED_MODULESIZE);
+		int nMinPenalty = bPacked ? CountPenaltyPacked(INT_MAX) : CountPenalty();
 
 		for (i = 1; i <= 7; i++) {
 			SetMaskingPattern(i); 			// Masking
 			SetFormatInfoPattern(i); 		// Placement pattern format information
 
-			int nPenalty = CountPenalty();
+			// Scoring stops early once a mask can no longer beat the best one
+			int nPenalty = bPacked ? CountPenaltyPacked(nMinPenalty) : CountPenalty();
 
 			if (nPenalty < nMinPenalty) {
 				nMinPenalty = nPenalty;
@@ -25,6 +25,7 @@
 #include <crypto.h>
 #include <layout.h>
 #include <confirm_sm.h>
+#include <trace.h>
 
 #include "signing.h"
 #include "fsm.h"
@@ -49,9 +50,49 @@ static TxStruct to, tp, ti;
 static SHA256_CTX tc;
 static uint8_t hash[32], hash_check[32], privkey[32], pubkey[33], sig[64];
 static uint64_t to_spend, spending, change_spend;
+static uint32_t tx_size;
 static bool multisig_fp_set, multisig_fp_mismatch;
 static uint8_t multisig_fp[32];
 
+typedef struct {
+	uint8_t prev_hash[32];
+	uint32_t prev_index;
+	uint32_t sequence;
+	uint8_t digest[32];
+} BatchInput;
+
+static uint32_t batch_buffer[SIGNING_BATCH_BUFFER_SIZE / sizeof(uint32_t)];
+static BatchInput *const batch_inputs = (BatchInput *)batch_buffer;
+static uint8_t *batch_outputs;
+static uint32_t batch_outputs_len;
+static bool batch_mode;
+
+/* Serialized transaction bytes are held back until a TxRequest can carry
+ * most of a serialized_tx chunk.  The threshold leaves room for one more
+ * output so the final TxRequest always has space for the remainder.
+ */
+#define SER_VERSION_LEN         4
+#define SER_COUNT_MAX           5   /* ser_length() of an input or output count */
+#define SER_PREVOUT_LEN         (32 + 4)    /* prev txid and vout */
+#define SER_SCRIPT_LEN_MAX      3   /* ser_length() of any script size */
+#define SER_SEQUENCE_LEN        4
+#define SER_AMOUNT_LEN          8
+#define SER_FOOTER_MAX          8   /* lock_time and hash type */
+
+#define SERIALIZED_INPUT_MAX    (SER_VERSION_LEN + SER_COUNT_MAX + SER_PREVOUT_LEN + \
+                                 SER_SCRIPT_LEN_MAX + sizeof(input.script_sig.bytes) + \
+                                 SER_SEQUENCE_LEN)
+#define SERIALIZED_OUTPUT_MAX   (SER_COUNT_MAX + SER_AMOUNT_LEN + SER_SCRIPT_LEN_MAX + \
+                                 sizeof(bin_output.script_pubkey.bytes) + SER_FOOTER_MAX)
+#define SERIALIZED_CHUNK_SIZE   sizeof(resp.serialized.serialized_tx.bytes)
+#define SERIALIZED_THRESHOLD    (SERIALIZED_CHUNK_SIZE - SERIALIZED_OUTPUT_MAX)
+
+static uint8_t serialized_buf[2 * SERIALIZED_CHUNK_SIZE];
+static uint32_t serialized_len;
+
+_Static_assert(SERIALIZED_THRESHOLD + SERIALIZED_INPUT_MAX <= sizeof(serialized_buf),
+               "serialized_buf cannot hold a signed input on top of held back bytes");
+
 /* === Variables =========================================================== */
 
 enum {
@@ -62,6 +103,7 @@ enum {
 	STAGE_REQUEST_3_OUTPUT,
 	STAGE_REQUEST_4_INPUT,
 	STAGE_REQUEST_4_OUTPUT,
+	STAGE_REQUEST_4_BATCH_INPUT,
 	STAGE_REQUEST_5_OUTPUT
 } signing_stage;
 const uint32_t version = 1;
@@ -107,6 +149,248 @@ static bool check_valid_output_address(TxOutputType *tx_out)
     return(ret_val);
 }
 
+/*
+ * batch_input_digest() - Computes the digest used to recognize an input when
+ * it is requested again in batch mode
+ *
+ * INPUT
+ *     - txinput: input as received from the host
+ *     - digest: buffer for the 32 byte digest
+ * OUTPUT
+ *     none
+ *
+ */
+static void batch_input_digest(const TxInputType *txinput, uint8_t *digest)
+{
+	SHA256_CTX ctx;
+	sha256_Init(&ctx);
+	tx_input_check_hash(&ctx, txinput);
+	sha256_Final(digest, &ctx);
+}
+
+/*
+ * batch_add_input() - Keeps the parts of an input needed to replay the
+ * signing stream from RAM
+ *
+ * INPUT
+ *     - txinput: input as received in the first pass of phase 2
+ * OUTPUT
+ *     none
+ *
+ */
+static void batch_add_input(const TxInputType *txinput)
+{
+	if (!batch_mode) {
+		return;
+	}
+
+	BatchInput *rec = &batch_inputs[idx2];
+	memcpy(rec->prev_hash, txinput->prev_hash.bytes, 32);
+	rec->prev_index = txinput->prev_index;
+	rec->sequence = txinput->sequence;
+	batch_input_digest(txinput, rec->digest);
+}
+
+/*
+ * batch_add_output() - Appends a compiled output to the batch buffer,
+ * leaving batch mode when it does not fit
+ *
+ * INPUT
+ *     - output: compiled output
+ * OUTPUT
+ *     none
+ *
+ */
+static void batch_add_output(const TxOutputBinType *output)
+{
+	if (!batch_mode) {
+		return;
+	}
+
+	uint32_t avail = SIGNING_BATCH_BUFFER_SIZE - inputs_count * sizeof(BatchInput) - batch_outputs_len;
+	uint16_t script_len = output->script_pubkey.size;
+
+	if (8 + sizeof(script_len) + script_len > avail) {
+		batch_mode = false;
+		return;
+	}
+
+	memcpy(batch_outputs + batch_outputs_len, &output->amount, 8);
+	batch_outputs_len += 8;
+	memcpy(batch_outputs + batch_outputs_len, &script_len, sizeof(script_len));
+	batch_outputs_len += sizeof(script_len);
+	memcpy(batch_outputs + batch_outputs_len, output->script_pubkey.bytes, script_len);
+	batch_outputs_len += script_len;
+}
+
+/*
+ * batch_input_sighash() - Computes the signature hash of input idx1 from the
+ * transaction kept in the batch buffer
+ *
+ * INPUT
+ *     - txinput: input to sign, with its script_sig filled in
+ *     - sighash: buffer for the 32 byte signature hash
+ * OUTPUT
+ *     true/false status
+ *
+ */
+static bool batch_input_sighash(const TxInputType *txinput, uint8_t *sighash)
+{
+	uint32_t i, offset = 0;
+	uint16_t script_len;
+
+	tx_init(&ti, inputs_count, outputs_count, version, lock_time, true);
+
+	for (i = 0; i < inputs_count; i++) {
+		if (i == idx1) {
+			if (!tx_serialize_input_hash(&ti, txinput)) {
+				return false;
+			}
+		} else if (!tx_serialize_prevout_hash(&ti, batch_inputs[i].prev_hash, batch_inputs[i].prev_index,
+		                                      0, 0, batch_inputs[i].sequence)) {
+			return false;
+		}
+	}
+
+	for (i = 0; i < outputs_count; i++) {
+		memset(&bin_output, 0, sizeof(TxOutputBinType));
+		memcpy(&bin_output.amount, batch_outputs + offset, 8);
+		offset += 8;
+		memcpy(&script_len, batch_outputs + offset, sizeof(script_len));
+		offset += sizeof(script_len);
+		memcpy(bin_output.script_pubkey.bytes, batch_outputs + offset, script_len);
+		bin_output.script_pubkey.size = script_len;
+		offset += script_len;
+		if (!tx_serialize_output_hash(&ti, &bin_output)) {
+			return false;
+		}
+	}
+
+	tx_hash_final(&ti, sighash, false);
+	return true;
+}
+
+/*
+ * serialized_flush() - Moves held back serialized transaction bytes into the
+ * pending response
+ *
+ * INPUT
+ *     - all: flush regardless of how much is pending
+ * OUTPUT
+ *     none
+ *
+ */
+static void serialized_flush(bool all)
+{
+	uint32_t chunk = serialized_len;
+
+	if (!all && serialized_len <= SERIALIZED_THRESHOLD) {
+		return;
+	}
+	if (chunk > SERIALIZED_CHUNK_SIZE) {
+		chunk = SERIALIZED_CHUNK_SIZE;
+	}
+	if (chunk == 0) {
+		return;
+	}
+
+	resp.has_serialized = true;
+	resp.serialized.has_serialized_tx = true;
+	memcpy(resp.serialized.serialized_tx.bytes, serialized_buf, chunk);
+	resp.serialized.serialized_tx.size = chunk;
+	serialized_len -= chunk;
+	memmove(serialized_buf, serialized_buf + chunk, serialized_len);
+}
+
+/*
+ * signing_prepare_input() - Derives the signing key for input idx1 and
+ * fills in the script_sig to be signed
+ *
+ * INPUT
+ *     - txinput: input to sign
+ * OUTPUT
+ *     true/false status
+ *
+ */
+static bool signing_prepare_input(TxInputType *txinput)
+{
+	memcpy(&input, txinput, sizeof(TxInputType));
+	memcpy(&node, root, sizeof(HDNode));
+	if (hdnode_private_ckd_cached(&node, txinput->address_n, txinput->address_n_count) == 0) {
+		fsm_sendFailure(FailureType_Failure_Other, "Failed to derive private key");
+		signing_abort();
+		return false;
+	}
+	if (txinput->script_type == InputScriptType_SPENDMULTISIG) {
+		if (!txinput->has_multisig) {
+			fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
+			signing_abort();
+			return false;
+		}
+		txinput->script_sig.size = compile_script_multisig(&(txinput->multisig), txinput->script_sig.bytes);
+	} else { // SPENDADDRESS
+		ecdsa_get_pubkeyhash(node.public_key, hash);
+		txinput->script_sig.size = compile_script_sig(coin->address_type, hash, txinput->script_sig.bytes);
+	}
+	if (txinput->script_sig.size == 0) {
+		fsm_sendFailure(FailureType_Failure_Other, "Failed to compile input");
+		signing_abort();
+		return false;
+	}
+	memcpy(privkey, node.private_key, 32);
+	memcpy(pubkey, node.public_key, 33);
+	return true;
+}
+
+/*
+ * signing_sign_input() - Signs the hash of input idx1 and puts the signature
+ * and the serialized input into the pending response
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false status
+ *
+ */
+static bool signing_sign_input(void)
+{
+	resp.has_serialized = true;
+	resp.serialized.has_signature_index = true;
+	resp.serialized.signature_index = idx1;
+	resp.serialized.has_signature = true;
+	TRACE_START(start);
+	ecdsa_sign_digest(&secp256k1, privkey, hash, sig, 0);
+	TRACE_PHASE(TRACE_PHASE_SIGN, start);
+	resp.serialized.signature.size = ecdsa_sig_to_der(sig, resp.serialized.signature.bytes);
+	if (input.script_type == InputScriptType_SPENDMULTISIG) {
+		if (!input.has_multisig) {
+			fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
+			signing_abort();
+			return false;
+		}
+		// fill in the signature
+		int pubkey_idx = cryptoMultisigPubkeyIndex(&(input.multisig), pubkey);
+		if (pubkey_idx < 0) {
+			fsm_sendFailure(FailureType_Failure_Other, "Pubkey not found in multisig script");
+			signing_abort();
+			return false;
+		}
+		memcpy(input.multisig.signatures[pubkey_idx].bytes, resp.serialized.signature.bytes, resp.serialized.signature.size);
+		input.multisig.signatures[pubkey_idx].size = resp.serialized.signature.size;
+		input.script_sig.size = serialize_script_multisig(&(input.multisig), input.script_sig.bytes);
+		if (input.script_sig.size == 0) {
+			fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize multisig script");
+			signing_abort();
+			return false;
+		}
+	} else { // SPENDADDRESS
+		input.script_sig.size = serialize_script_sig(resp.serialized.signature.bytes, resp.serialized.signature.size, pubkey, 33, input.script_sig.bytes);
+	}
+	serialized_len += tx_serialize_input(&to, &input, serialized_buf + serialized_len);
+	serialized_flush(false);
+	return true;
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -155,10 +439,23 @@ foreach I (idx1):  // input to sign
         Failure
     Sign StreamTransactionSign
     Return signed chunk
+    If the first pass fit in the batch buffer:
+        continue with Phase2 batch
+Phase2 batch: sign remaining inputs from the first pass kept in RAM
+==================================================================
+foreach remaining I (idx1):
+    Request I                                                         STAGE_REQUEST_4_BATCH_INPUT
+    Compare I with the copy checked in the first pass
+    Fill scriptsig
+    Replay StreamTransactionSign from RAM
+    Sign StreamTransactionSign
+    Return signed chunk
 foreach O (idx1):
     Request O                                                         STAGE_REQUEST_5_OUTPUT
     Rewrite change address
     Return O
+Signed chunks and outputs are held back and returned in serialized_tx
+chunks of up to 2 KB; whatever is left goes out with TXFINISHED.
 */
 
 void send_req_1_input(void)
@@ -245,6 +542,17 @@ void send_req_4_output(void)
 	msg_write(MessageType_MessageType_TxRequest, &resp);
 }
 
+void send_req_4_batch_input(void)
+{
+	signing_stage = STAGE_REQUEST_4_BATCH_INPUT;
+	resp.has_request_type = true;
+	resp.request_type = RequestType_TXINPUT;
+	resp.has_details = true;
+	resp.details.has_request_index = true;
+	resp.details.request_index = idx1;
+	msg_write(MessageType_MessageType_TxRequest, &resp);
+}
+
 void send_req_5_output(void)
 {
 	signing_stage = STAGE_REQUEST_5_OUTPUT;
@@ -263,6 +571,32 @@ void send_req_finished(void)
 	msg_write(MessageType_MessageType_TxRequest, &resp);
 }
 
+/*
+ * signing_next_input() - Requests the next input to sign, or moves on to
+ * returning the outputs once all inputs are signed
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+static void signing_next_input(void)
+{
+	if (idx1 < inputs_count - 1) {
+		idx1++;
+		idx2 = 0;
+		if (batch_mode) {
+			send_req_4_batch_input();
+		} else {
+			send_req_4_input();
+		}
+	} else {
+		idx1 = 0;
+		send_req_5_output();
+	}
+}
+
 void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinType *_coin, const HDNode *_root)
 {
 	inputs_count = _inputs_count;
@@ -274,6 +608,7 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
 	to_spend = 0;
 	spending = 0;
 	change_spend = 0;
+	tx_size = tx_header_size(inputs_count, outputs_count);
 	memset(&input, 0, sizeof(TxInputType));
 	memset(&resp, 0, sizeof(TxRequest));
 
@@ -281,6 +616,10 @@ void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinTyp
 
 	multisig_fp_set = false;
 	multisig_fp_mismatch = false;
+	cryptoMultisigCacheClear();
+
+	batch_mode = false;
+	serialized_len = 0;
 
 	tx_init(&to, inputs_count, outputs_count, version, lock_time, false);
 	sha256_Init(&tc);
@@ -339,8 +678,17 @@ void signing_txack(TransactionType *tx)
 			} else { // InputScriptType_SPENDADDRESS
 				multisig_fp_mismatch = true;
 			}
-			sha256_Update(&tc, (const uint8_t *)tx->inputs, sizeof(TxInputType));
-			memcpy(&input, tx->inputs, sizeof(TxInputType));
+			co = tx_input_size(tx->inputs);
+			if (co == 0) {
+				fsm_sendFailure(FailureType_Failure_Other, "Failed to compile input");
+				signing_abort();
+				return;
+			}
+			tx_size += co;
+			tx_input_check_hash(&tc, tx->inputs);
+			/* phase 1 only needs the outpoint of the input */
+			memcpy(&input.prev_hash, &(tx->inputs[0].prev_hash), sizeof(input.prev_hash));
+			input.prev_index = tx->inputs[0].prev_index;
 			send_req_2_prev_meta();
 			return;
 		case STAGE_REQUEST_2_PREV_META:
@@ -456,7 +804,8 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			sha256_Update(&tc, (const uint8_t *)&bin_output, sizeof(TxOutputBinType));
+			tx_size += tx_output_size(&bin_output);
+			tx_output_check_hash(&tc, &bin_output);
 			if (idx1 < outputs_count - 1) {
 				idx1++;
 				send_req_3_output();
@@ -469,13 +818,13 @@ void signing_txack(TransactionType *tx)
 				return;
                             }
                             uint64_t fee = to_spend - spending;
-                            uint32_t tx_est_size = transactionEstimateSizeKb(inputs_count, outputs_count);
+                            uint32_t tx_size_kb = transactionSizeKb(tx_size);
                             char total_amount_str[32];
 		            char fee_str[32];
 
 		            coin_amnt_to_str(coin, fee, fee_str, sizeof(fee_str));
 
-                            if(fee > (uint64_t)tx_est_size * coin->maxfee_kb) {
+                            if(fee > (uint64_t)tx_size_kb * coin->maxfee_kb) {
 			        if (!confirm(ButtonRequestType_ButtonRequest_FeeOverThreshold,
 		                        "Confirm Fee", "%s", fee_str)) {
 		                    fsm_sendFailure(FailureType_Failure_ActionCancelled, "Fee over threshold. Signing cancelled.");
@@ -511,34 +860,21 @@ void signing_txack(TransactionType *tx)
 				sha256_Update(&tc, (const uint8_t *)&lock_time, sizeof(lock_time));
 				memset(privkey, 0, 32);
 				memset(pubkey, 0, 33);
+				if (idx1 == 0) {
+					batch_mode = inputs_count > 1 &&
+					             inputs_count <= SIGNING_BATCH_BUFFER_SIZE / sizeof(BatchInput);
+					batch_outputs = (uint8_t *)batch_buffer + inputs_count * sizeof(BatchInput);
+					batch_outputs_len = 0;
+				}
+			}
+			tx_input_check_hash(&tc, tx->inputs);
+			if (idx1 == 0) {
+				batch_add_input(tx->inputs);
 			}
-			sha256_Update(&tc, (const uint8_t *)tx->inputs, sizeof(TxInputType));
 			if (idx2 == idx1) {
-				memcpy(&input, tx->inputs, sizeof(TxInputType));
-				memcpy(&node, root, sizeof(HDNode));
-				if (hdnode_private_ckd_cached(&node, tx->inputs[0].address_n, tx->inputs[0].address_n_count) == 0) {
-					fsm_sendFailure(FailureType_Failure_Other, "Failed to derive private key");
-					signing_abort();
-					return;
-				}
-				if (tx->inputs[0].script_type == InputScriptType_SPENDMULTISIG) {
-					if (!tx->inputs[0].has_multisig) {
-						fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
-						signing_abort();
-						return;
-					}
-					tx->inputs[0].script_sig.size = compile_script_multisig(&(tx->inputs[0].multisig), tx->inputs[0].script_sig.bytes);
-				} else { // SPENDADDRESS
-					ecdsa_get_pubkeyhash(node.public_key, hash);
-					tx->inputs[0].script_sig.size = compile_script_sig(coin->address_type, hash, tx->inputs[0].script_sig.bytes);
-				}
-				if (tx->inputs[0].script_sig.size == 0) {
-					fsm_sendFailure(FailureType_Failure_Other, "Failed to compile input");
-					signing_abort();
+				if (!signing_prepare_input(tx->inputs)) {
 					return;
 				}
-				memcpy(privkey, node.private_key, 32);
-				memcpy(pubkey, node.public_key, 33);
 			} else {
 				tx->inputs[0].script_sig.size = 0;
 			}
@@ -566,7 +902,10 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			sha256_Update(&tc, (const uint8_t *)&bin_output, sizeof(TxOutputBinType));
+			tx_output_check_hash(&tc, &bin_output);
+			if (idx1 == 0) {
+				batch_add_output(&bin_output);
+			}
 			if (!tx_serialize_output_hash(&ti, &bin_output)) {
 				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize output");
 				signing_abort();
@@ -583,50 +922,36 @@ void signing_txack(TransactionType *tx)
 					return;
 				}
 				tx_hash_final(&ti, hash, false);
-				resp.has_serialized = true;
-				resp.serialized.has_signature_index = true;
-				resp.serialized.signature_index = idx1;
-				resp.serialized.has_signature = true;
-				resp.serialized.has_serialized_tx = true;
-				ecdsa_sign_digest(&secp256k1, privkey, hash, sig, 0);
-				resp.serialized.signature.size = ecdsa_sig_to_der(sig, resp.serialized.signature.bytes);
-				if (input.script_type == InputScriptType_SPENDMULTISIG) {
-					if (!input.has_multisig) {
-						fsm_sendFailure(FailureType_Failure_Other, "Multisig info not provided");
-						signing_abort();
-						return;
-					}
-					// fill in the signature
-					int pubkey_idx = cryptoMultisigPubkeyIndex(&(input.multisig), pubkey);
-					if (pubkey_idx < 0) {
-						fsm_sendFailure(FailureType_Failure_Other, "Pubkey not found in multisig script");
-						signing_abort();
-						return;
-					}
-					memcpy(input.multisig.signatures[pubkey_idx].bytes, resp.serialized.signature.bytes, resp.serialized.signature.size);
-					input.multisig.signatures[pubkey_idx].size = resp.serialized.signature.size;
-					input.script_sig.size = serialize_script_multisig(&(input.multisig), input.script_sig.bytes);
-					if (input.script_sig.size == 0) {
-						fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize multisig script");
-						signing_abort();
-						return;
-					}
-				} else { // SPENDADDRESS
-					input.script_sig.size = serialize_script_sig(resp.serialized.signature.bytes, resp.serialized.signature.size, pubkey, 33, input.script_sig.bytes);
+				if (!signing_sign_input()) {
+					return;
 				}
-				resp.serialized.serialized_tx.size = tx_serialize_input(&to, &input, resp.serialized.serialized_tx.bytes);
 				// since this took a longer time, update progress
 				animating_progress_handler();
 				update_ctr = 0;
-				if (idx1 < inputs_count - 1) {
-					idx1++;
-					idx2 = 0;
-					send_req_4_input();
-				} else {
-					idx1 = 0;
-					send_req_5_output();
-				}
+				signing_next_input();
+			}
+			return;
+		case STAGE_REQUEST_4_BATCH_INPUT:
+			batch_input_digest(tx->inputs, hash);
+			if (memcmp(hash, batch_inputs[idx1].digest, 32) != 0) {
+				fsm_sendFailure(FailureType_Failure_Other, "Transaction has changed during signing");
+				signing_abort();
+				return;
+			}
+			if (!signing_prepare_input(tx->inputs)) {
+				return;
+			}
+			if (!batch_input_sighash(tx->inputs, hash)) {
+				fsm_sendFailure(FailureType_Failure_Other, "Failed to serialize input");
+				signing_abort();
+				return;
+			}
+			if (!signing_sign_input()) {
+				return;
 			}
+			animating_progress_handler();
+			update_ctr = 0;
+			signing_next_input();
 			return;
 		case STAGE_REQUEST_5_OUTPUT:
 			if (compile_output(coin, root, tx->outputs, &bin_output,false) <= 0) {
@@ -634,13 +959,13 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			resp.has_serialized = true;
-			resp.serialized.has_serialized_tx = true;
-			resp.serialized.serialized_tx.size = tx_serialize_output(&to, &bin_output, resp.serialized.serialized_tx.bytes);
+			serialized_len += tx_serialize_output(&to, &bin_output, serialized_buf + serialized_len);
 			if (idx1 < outputs_count - 1) {
+				serialized_flush(false);
 				idx1++;
 				send_req_5_output();
 			} else {
+				serialized_flush(true);
 				send_req_finished();
 				signing_abort();
 			}
@@ -656,5 +981,7 @@ void signing_abort(void)
 	if (signing) {
 		go_home();
 		signing = false;
+		cryptoMultisigCacheClear();
+		serialized_len = 0;
 	}
 }
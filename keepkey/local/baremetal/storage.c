@@ -21,11 +21,15 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stddef.h>
 
+#include <libopencm3/stm32/crc.h>
 #include <libopencm3/stm32/flash.h>
 
 #include <bip39.h>
 #include <aes.h>
+#include <hmac.h>
+#include <sha2.h>
 #include <pbkdf2.h>
 #include <keepkey_board.h>
 #include <pbkdf2.h>
@@ -51,10 +55,29 @@ static bool sessionPassphraseCached;
 static char sessionPassphrase[51];
 static Allocation storage_location = FLASH_INVALID;
 
+/* Configuration the snapshot and log in flash currently decode to */
+static ConfigFlash committed_config;
+static bool log_valid = false;
+static uint32_t log_offset;
+
+/* PIN failure counter area holds a count carried over by compaction */
+static bool pin_area_valid = false;
+static bool pin_fails_reset_pending = false;
+
+/* Regions that can only be appended to while they are still blank */
+static const StorageRegion secret_regions[] =
+{
+    { offsetof(ConfigFlash, storage.node), sizeof(((ConfigFlash *)NULL)->storage.node) },
+    { offsetof(ConfigFlash, storage.mnemonic), sizeof(((ConfigFlash *)NULL)->storage.mnemonic) },
+    { offsetof(ConfigFlash, storage.pin), sizeof(((ConfigFlash *)NULL)->storage.pin) },
+    { offsetof(ConfigFlash, cache), sizeof(((ConfigFlash *)NULL)->cache) }
+};
+
 /* === Variables =========================================================== */
 
 /* Shadow memory for configuration data in storage partition */
-_Static_assert(sizeof(ConfigFlash) <= FLASH_STORAGE_LEN, "ConfigFlash struct is too large for storage partition");
+_Static_assert(sizeof(ConfigFlash) <= STORAGE_PIN_AREA_START, "ConfigFlash struct is too large for storage partition");
+_Static_assert(sizeof(ConfigFlash) % sizeof(uint32_t) == 0, "ConfigFlash struct must be word sized for crc32");
 static ConfigFlash shadow_config;
 
 /* === Private Functions =================================================== */
@@ -74,6 +97,11 @@ static bool storage_from_flash(ConfigFlash *stor_config)
     switch(stor_config->storage.version)
     {
         case 1:
+            /* Account node cache follows the version 1 layout and starts out empty */
+            memcpy(&shadow_config, stor_config, offsetof(ConfigFlash, cache.account_cache));
+            break;
+
+        case 2:
             memcpy(&shadow_config, stor_config, sizeof(shadow_config));
             break;
 
@@ -171,137 +199,432 @@ static bool storage_get_root_node_cache(HDNode *node)
     return false;
 }
 
-/* === Functions =========================================================== */
+/*
+ * storage_record_crc() - Calculate crc32 of a log record
+ *
+ * INPUT
+ *     - record: record header
+ *     - data: record patch data
+ * OUTPUT
+ *     crc32 of header and data
+ *
+ */
+static uint32_t storage_record_crc(const StorageRecord *record, const uint8_t *data)
+{
+    uint32_t header;
+
+    memcpy(&header, record, sizeof(header));
+
+    crc_reset();
+    crc_calculate(header);
+    return(crc_calculate_block((uint32_t *)data, record->len / sizeof(uint32_t)));
+}
 
 /*
- * storage_init() - Validate storage content and copy data to shadow memory
+ * storage_log_replay() - Apply log records following the snapshot to shadow
+ * memory
  *
  * INPUT
- *     none
+ *     - stor_config: storage config
+ *     - config_len: size of the snapshot, the log starts right after it
+ *     - log_end: offset in sector where the log area ends
  * OUTPUT
- *     none
+ *     true if log ends cleanly, false if a torn or corrupt record was found
+ *
  */
-void storage_init(void)
+static bool storage_log_replay(ConfigFlash *stor_config, uint32_t config_len,
+                               uint32_t log_end)
 {
-    ConfigFlash *stor_config;
+    const uint8_t *base = (const uint8_t *)stor_config;
+    const StorageRecord *record;
+    const uint8_t *data;
+    uint32_t crc;
 
-    /* Find storage sector with valid data and set storage_location variable */
-    if(find_active_storage(&storage_location))
+    log_offset = config_len;
+
+    while(log_offset + STORAGE_RECORD_SIZE(0) <= log_end)
     {
-        stor_config = (ConfigFlash *)flash_write_helper(storage_location);
+        record = (const StorageRecord *)(base + log_offset);
+        data = base + log_offset + sizeof(StorageRecord);
+
+        /* Erased flash marks the end of the log */
+        if(record->offset == 0xFFFF && record->len == 0xFFFF)
+        {
+            return(true);
+        }
+
+        if(record->len == 0 || record->len % sizeof(uint32_t) ||
+                record->offset % sizeof(uint32_t) ||
+                record->offset + record->len > config_len ||
+                log_offset + STORAGE_RECORD_SIZE(record->len) > log_end)
+        {
+            return(false);
+        }
+
+        memcpy(&crc, data + record->len, sizeof(crc));
+
+        if(storage_record_crc(record, data) != crc)
+        {
+            return(false);
+        }
+
+        memcpy((uint8_t *)&shadow_config + record->offset, data, record->len);
+        log_offset += STORAGE_RECORD_SIZE(record->len);
     }
-    else
+
+    return(true);
+}
+
+/*
+ * storage_next_change() - Find next range of shadow memory that differs from
+ * committed configuration
+ *
+ * INPUT
+ *     - offset: offset to search from, set to start of range found
+ *     - len: set to length of range found
+ * OUTPUT
+ *     true if a changed range was found
+ *
+ */
+static bool storage_next_change(uint32_t *offset, uint32_t *len)
+{
+    const uint32_t *cur = (const uint32_t *)&shadow_config;
+    const uint32_t *old = (const uint32_t *)&committed_config;
+    uint32_t words = sizeof(ConfigFlash) / sizeof(uint32_t);
+    uint32_t i = *offset / sizeof(uint32_t), j, end;
+
+    while(i < words && cur[i] == old[i])
     {
-        /* Set to storage sector1 as default if no sector has been initialized */
-        storage_location = STORAGE_SECT_DEFAULT;
-        stor_config = (ConfigFlash *)flash_write_helper(storage_location);
+        i++;
     }
 
-    /* Reset shadow configuration in RAM */
-    storage_reset();
+    if(i == words)
+    {
+        return(false);
+    }
 
-    /* Verify storage partition is initialized */
-    if(memcmp((void *)stor_config->meta.magic , STORAGE_MAGIC_STR,
-              STORAGE_MAGIC_LEN) == 0)
+    /* Merge changes closer together than the overhead of another record */
+    end = i + 1;
+
+    for(j = end; j < words && j - end < STORAGE_RECORD_GAP; j++)
     {
-        /* Clear out stor_config before finding end config node */
-        memcpy(shadow_config.meta.uuid, (void *)&stor_config->meta.uuid,
-               sizeof(shadow_config.meta.uuid));
-        data2hex(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
-                 shadow_config.meta.uuid_str);
+        if(cur[j] != old[j])
+        {
+            end = j + 1;
+        }
+    }
 
-        if(stor_config->storage.version)
+    *offset = i * sizeof(uint32_t);
+    *len = (end - i) * sizeof(uint32_t);
+    return(true);
+}
+
+/*
+ * storage_change_appendable() - Check a changed range can be appended to the
+ * log without leaving a secret behind in flash
+ *
+ * INPUT
+ *     - offset: offset of changed range
+ *     - len: length of changed range
+ * OUTPUT
+ *     true/false
+ *
+ */
+static bool storage_change_appendable(uint32_t offset, uint32_t len)
+{
+    const uint8_t *old = (const uint8_t *)&committed_config;
+    uint32_t i, start, end;
+
+    for(i = 0; i < sizeof(secret_regions) / sizeof(secret_regions[0]); i++)
+    {
+        start = secret_regions[i].offset > offset ? secret_regions[i].offset : offset;
+        end = secret_regions[i].offset + secret_regions[i].len;
+
+        if(end > offset + len)
+        {
+            end = offset + len;
+        }
+
+        for(; start < end; start++)
         {
-            if(stor_config->storage.version <= STORAGE_VERSION)
+            if(old[start] != 0)
             {
-                storage_from_flash(stor_config);
+                return(false);
             }
         }
+    }
 
-        /* New app with storage version changed!  update the storage space */
-        if(stor_config->storage.version != STORAGE_VERSION)
+    return(true);
+}
+
+/*
+ * storage_record_write() - Append one record to the log and verify it
+ *
+ * INPUT
+ *     - offset: offset of patched range in ConfigFlash
+ *     - len: length of patched range
+ * OUTPUT
+ *     true/false status of write
+ *
+ */
+static bool storage_record_write(uint32_t offset, uint32_t len)
+{
+    StorageRecord record;
+    const uint8_t *flash_record;
+    uint8_t *data = (uint8_t *)&shadow_config + offset;
+    uint32_t crc, flash_crc;
+
+    record.offset = offset;
+    record.len = len;
+    crc = storage_record_crc(&record, data);
+
+    if(!flash_write_word(storage_location, log_offset, sizeof(record), (uint8_t *)&record) ||
+            !flash_write_word(storage_location, log_offset + sizeof(record), len, data) ||
+            !flash_write_word(storage_location, log_offset + sizeof(record) + len,
+                              sizeof(crc), (uint8_t *)&crc))
+    {
+        return(false);
+    }
+
+    /* Verify what landed in flash the same way it is checked at replay */
+    flash_record = (const uint8_t *)flash_write_helper(storage_location) + log_offset;
+    memcpy(&flash_crc, flash_record + sizeof(record) + len, sizeof(flash_crc));
+
+    if(flash_crc != crc ||
+            storage_record_crc((const StorageRecord *)flash_record,
+                               flash_record + sizeof(record)) != crc)
+    {
+        return(false);
+    }
+
+    log_offset += STORAGE_RECORD_SIZE(len);
+    return(true);
+}
+
+/*
+ * storage_log_append() - Append changes since last commit to the log
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true if changes were appended, false if a full snapshot is needed
+ *
+ */
+static bool storage_log_append(void)
+{
+    bool ret_val = true;
+    uint32_t offset, len, size = 0;
+
+    if(!log_valid)
+    {
+        return(false);
+    }
+
+    for(offset = 0; storage_next_change(&offset, &len); offset += len)
+    {
+        if(!storage_change_appendable(offset, len))
         {
-            storage_commit();
+            return(false);
         }
+
+        size += STORAGE_RECORD_SIZE(len);
     }
-    else
+
+    if(log_offset + size > STORAGE_LOG_END)
     {
-        /* Keep storage area cleared */
-        storage_reset_uuid();
-        storage_commit();
+        return(false);
+    }
+
+    flash_unlock();
+
+    for(offset = 0; storage_next_change(&offset, &len); offset += len)
+    {
+        if(!storage_record_write(offset, len))
+        {
+            /* Snapshot rewrite erases the bad record */
+            log_valid = false;
+            ret_val = false;
+            break;
+        }
+    }
+
+    flash_lock();
+
+    if(ret_val)
+    {
+        memcpy(&committed_config, &shadow_config, sizeof(committed_config));
     }
+
+    return(ret_val);
 }
 
 /*
- * storage_reset_uuid() - Reset configuration uuid in RAM with random numbers
+ * storage_pin_area() - Get PIN failure counter area of active storage sector
  *
  * INPUT
  *     none
  * OUTPUT
- *     none
+ *     pointer to counter words
  *
  */
-void storage_reset_uuid(void)
+static const uint32_t *storage_pin_area(void)
 {
-    // set random uuid
-    random_buffer(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid));
-    data2hex(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
-             shadow_config.meta.uuid_str);
+    return((const uint32_t *)(flash_write_helper(storage_location) + STORAGE_PIN_AREA_START));
 }
 
 /*
- * storage_reset() - Clear configuration in RAM
+ * storage_pin_word() - Find open word of PIN failure counter
  *
  * INPUT
  *     none
  * OUTPUT
+ *     index of open word, STORAGE_PIN_WORDS if all words are closed
+ *
+ */
+static uint32_t storage_pin_word(void)
+{
+    const uint32_t *area = storage_pin_area();
+    uint32_t i = 0;
+
+    while(i < STORAGE_PIN_WORDS && !(area[i] & STORAGE_PIN_OPEN))
+    {
+        i++;
+    }
+
+    return(i);
+}
+
+/*
+ * storage_pin_count() - Count failures recorded in a PIN failure counter word
+ *
+ * INPUT
+ *     - index: index of counter word
+ * OUTPUT
+ *     number of PIN failures
+ *
+ */
+static uint32_t storage_pin_count(uint32_t index)
+{
+    if(index >= STORAGE_PIN_WORDS)
+    {
+        return(0);
+    }
+
+    return(__builtin_popcount(~storage_pin_area()[index] & ~STORAGE_PIN_OPEN));
+}
+
+/*
+ * storage_pin_program() - Program a PIN failure counter word, bits can only
+ * be cleared
+ *
+ * INPUT
+ *     - index: index of counter word
+ *     - word: new value of counter word
+ * OUTPUT
  *     none
+ *
  */
-void storage_reset(void)
+static void storage_pin_program(uint32_t index, uint32_t word)
 {
-    // reset storage and cache
-    memset(&shadow_config.storage, 0, sizeof(shadow_config.storage));
-    memset(&shadow_config.cache, 0, sizeof(shadow_config.cache));
+    uint32_t retries;
+    bool ok;
 
-    shadow_config.storage.version = STORAGE_VERSION;
-    session_clear(true); // clear PIN as well
+    for(retries = 0; retries < STORAGE_RETRIES; retries++)
+    {
+        flash_unlock();
+        ok = flash_write_word(storage_location, STORAGE_PIN_AREA_START + index * sizeof(uint32_t),
+                              sizeof(word), (uint8_t *)&word);
+        flash_lock();
+
+        if(ok && storage_pin_area()[index] == word)
+        {
+            break;
+        }
+    }
+
+    if(retries >= STORAGE_RETRIES)
+    {
+        layout_warning_static("Error Detected.  Reboot Device!");
+        system_halt();
+    }
 }
 
 /*
- * session_clear() - Reset session states
+ * storage_pin_area_check() - Check that the PIN failure counter area holds
+ * closed words, at most one open word and erased words, in that order
  *
  * INPUT
- *     - clear_pin: whether to clear pin or not
+ *     none
+ * OUTPUT
+ *     true/false whether area is a valid counter
+ *
+ */
+static bool storage_pin_area_check(void)
+{
+    const uint32_t *area = storage_pin_area();
+    uint32_t i = storage_pin_word(), cleared;
+
+    if(i < STORAGE_PIN_WORDS)
+    {
+        /* Failures clear bits from bit 0 up */
+        cleared = ~area[i] & ~STORAGE_PIN_OPEN;
+
+        if(cleared & (cleared + 1))
+        {
+            return(false);
+        }
+
+        i++;
+    }
+
+    for(; i < STORAGE_PIN_WORDS; i++)
+    {
+        if(area[i] != 0xFFFFFFFF)
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/*
+ * storage_pin_set() - Raise PIN failure count in open counter word
+ *
+ * INPUT
+ *     - fails: number of PIN failures
  * OUTPUT
  *     none
+ *
  */
-void session_clear(bool clear_pin)
+static void storage_pin_set(uint32_t fails)
 {
-    sessionRootNodeCached = false;
-    memset(&sessionRootNode, 0, sizeof(sessionRootNode));
-    sessionPassphraseCached = false;
-    memset(&sessionPassphrase, 0, sizeof(sessionPassphrase));
+    uint32_t index = storage_pin_word();
 
-    if(clear_pin)
+    if(fails > STORAGE_PIN_FAILS_MAX)
     {
-        sessionPinCached = false;
+        fails = STORAGE_PIN_FAILS_MAX;
+    }
+
+    if(index < STORAGE_PIN_WORDS && storage_pin_count(index) < fails)
+    {
+        storage_pin_program(index, storage_pin_area()[index] & ~((1u << fails) - 1));
     }
 }
 
 /*
- * storage_commit() - Write content of configuration in shadow memory to
- * storage partion in flash
+ * storage_compact() - Write content of configuration in shadow memory as a
+ * new snapshot in the next storage sector, erasing the log
  *
  * INPUT
  *     none
  * OUTPUT
  *     none
  */
-void storage_commit(void)
+static void storage_compact(void)
 {
     uint32_t shadow_ram_crc32, shadow_flash_crc32, retries;
-
-    memcpy((void *)&shadow_config, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
+    uint32_t pin_fails = pin_area_valid ? storage_get_pin_fails() : 0;
 
     for(retries = 0; retries < STORAGE_RETRIES; retries++)
     {
@@ -358,7 +681,10 @@ void storage_commit(void)
 
         if(shadow_flash_crc32 == shadow_ram_crc32)
         {
-            /* Commit successful, break to exit */
+            /* Commit successful, log restarts after the new snapshot */
+            memcpy(&committed_config, &shadow_config, sizeof(committed_config));
+            log_offset = STORAGE_LOG_START;
+            log_valid = true;
             break;
         }
         else
@@ -374,6 +700,228 @@ void storage_commit(void)
         layout_warning_static("Error Detected.  Reboot Device!");
         system_halt();
     }
+
+    /* Carry PIN failures over to the counter area of the new sector */
+    pin_area_valid = true;
+    storage_pin_set(pin_fails);
+}
+
+/*
+ * storage_account_cache_keys() - Derive account node cache keys from the
+ * stored seed
+ *
+ * INPUT
+ *     - keys: buffer for encryption key followed by mac key
+ * OUTPUT
+ *     none
+ *
+ */
+static void storage_account_cache_keys(uint8_t keys[64])
+{
+    /* Keys are bound to the seed, so entries never outlive it */
+    if(shadow_config.storage.has_mnemonic)
+    {
+        hmac_sha512(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
+                    (const uint8_t *)shadow_config.storage.mnemonic,
+                    strlen(shadow_config.storage.mnemonic), keys);
+    }
+    else
+    {
+        hmac_sha512(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
+                    shadow_config.storage.node.private_key.bytes,
+                    sizeof(shadow_config.storage.node.private_key.bytes), keys);
+    }
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * storage_init() - Validate storage content and copy data to shadow memory
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_init(void)
+{
+    ConfigFlash *stor_config;
+
+    /* Find storage sector with valid data and set storage_location variable */
+    if(find_active_storage(&storage_location))
+    {
+        stor_config = (ConfigFlash *)flash_write_helper(storage_location);
+    }
+    else
+    {
+        /* Set to storage sector1 as default if no sector has been initialized */
+        storage_location = STORAGE_SECT_DEFAULT;
+        stor_config = (ConfigFlash *)flash_write_helper(storage_location);
+    }
+
+    /* Reset shadow configuration in RAM, PIN failures in flash still count */
+    storage_reset();
+    pin_fails_reset_pending = false;
+
+    /* Verify storage partition is initialized */
+    if(memcmp((void *)stor_config->meta.magic , STORAGE_MAGIC_STR,
+              STORAGE_MAGIC_LEN) == 0)
+    {
+        uint32_t pin_fails;
+
+        pin_area_valid = true;
+
+        /* Clear out stor_config before finding end config node */
+        memcpy(shadow_config.meta.uuid, (void *)&stor_config->meta.uuid,
+               sizeof(shadow_config.meta.uuid));
+        data2hex(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
+                 shadow_config.meta.uuid_str);
+
+        if(stor_config->storage.version)
+        {
+            if(stor_config->storage.version <= STORAGE_VERSION &&
+                    storage_from_flash(stor_config))
+            {
+                if(stor_config->storage.version == STORAGE_VERSION)
+                {
+                    log_valid = storage_log_replay(stor_config, STORAGE_LOG_START,
+                                                   STORAGE_LOG_END);
+                }
+                else
+                {
+                    /* Records may hold the only copy of the seed, replay before migrating */
+                    storage_log_replay(stor_config, STORAGE_V1_CONFIG_LEN, STORAGE_V1_LOG_END);
+
+                    /* Only trust the counter area if no log record ran into it */
+                    pin_area_valid = log_offset <= STORAGE_PIN_AREA_START &&
+                                     storage_pin_area_check();
+                }
+            }
+        }
+
+        /* New app with storage version changed!  update the storage space */
+        if(stor_config->storage.version != STORAGE_VERSION)
+        {
+            log_valid = false;
+        }
+
+        if(log_valid)
+        {
+            memcpy(&committed_config, &shadow_config, sizeof(committed_config));
+        }
+
+        /* Move PIN failures kept in the config by older firmware to the counter area */
+        if(shadow_config.storage.has_pin_failed_attempts)
+        {
+            pin_fails = shadow_config.storage.pin_failed_attempts;
+            shadow_config.storage.has_pin_failed_attempts = false;
+            shadow_config.storage.pin_failed_attempts = 0;
+
+            if(pin_area_valid)
+            {
+                storage_pin_set(pin_fails);
+            }
+
+            storage_commit();
+
+            /* Counter area of the sector the commit left active */
+            storage_pin_set(pin_fails);
+        }
+        else if(!log_valid)
+        {
+            /* Rewrite snapshot, dropping any torn record at the end of the log */
+            storage_commit();
+        }
+    }
+    else
+    {
+        /* Keep storage area cleared */
+        storage_reset_uuid();
+        storage_commit();
+    }
+}
+
+/*
+ * storage_reset_uuid() - Reset configuration uuid in RAM with random numbers
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+void storage_reset_uuid(void)
+{
+    // set random uuid
+    random_buffer(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid));
+    data2hex(shadow_config.meta.uuid, sizeof(shadow_config.meta.uuid),
+             shadow_config.meta.uuid_str);
+}
+
+/*
+ * storage_reset() - Clear configuration in RAM
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_reset(void)
+{
+    // reset storage and cache
+    memset(&shadow_config.storage, 0, sizeof(shadow_config.storage));
+    memset(&shadow_config.cache, 0, sizeof(shadow_config.cache));
+
+    shadow_config.storage.version = STORAGE_VERSION;
+    pin_fails_reset_pending = true;
+    session_clear(true); // clear PIN as well
+}
+
+/*
+ * session_clear() - Reset session states
+ *
+ * INPUT
+ *     - clear_pin: whether to clear pin or not
+ * OUTPUT
+ *     none
+ */
+void session_clear(bool clear_pin)
+{
+    sessionRootNodeCached = false;
+    memset(&sessionRootNode, 0, sizeof(sessionRootNode));
+    sessionPassphraseCached = false;
+    memset(&sessionPassphrase, 0, sizeof(sessionPassphrase));
+
+    if(clear_pin)
+    {
+        sessionPinCached = false;
+    }
+}
+
+/*
+ * storage_commit() - Write content of configuration in shadow memory to
+ * storage partion in flash
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void storage_commit(void)
+{
+    memcpy((void *)&shadow_config, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
+
+    if(!storage_log_append())
+    {
+        storage_compact();
+    }
+
+    /* Config was reset, so is the PIN failure count */
+    if(pin_fails_reset_pending)
+    {
+        pin_fails_reset_pending = false;
+        storage_reset_pin_fails();
+    }
 }
 
 /*
@@ -607,14 +1155,14 @@ bool session_is_pin_cached(void)
  */
 void storage_reset_pin_fails(void)
 {
+    uint32_t index = storage_pin_word();
+
     /* Only write to flash if there's a change in status */
-    if(shadow_config.storage.has_pin_failed_attempts == true)
+    if(storage_pin_count(index) != 0)
     {
-        shadow_config.storage.has_pin_failed_attempts = false;
-        shadow_config.storage.pin_failed_attempts = 0;
-        storage_commit();
+        /* Closing the word starts a new count in the next one */
+        storage_pin_program(index, 0);
     }
-
 }
 
 /*
@@ -627,17 +1175,21 @@ void storage_reset_pin_fails(void)
  */
 void storage_increase_pin_fails(void)
 {
-    if(!shadow_config.storage.has_pin_failed_attempts)
+    uint32_t index = storage_pin_word(), fails;
+
+    /* Counter area is only erased once every word has been closed */
+    if(index >= STORAGE_PIN_WORDS)
     {
-        shadow_config.storage.has_pin_failed_attempts = true;
-        shadow_config.storage.pin_failed_attempts = 1;
+        storage_compact();
+        index = storage_pin_word();
     }
-    else
+
+    fails = storage_pin_count(index);
+
+    if(fails < STORAGE_PIN_FAILS_MAX)
     {
-        shadow_config.storage.pin_failed_attempts++;
+        storage_pin_program(index, storage_pin_area()[index] & ~(1u << fails));
     }
-
-    storage_commit();
 }
 
 /*
@@ -650,8 +1202,7 @@ void storage_increase_pin_fails(void)
  */
 uint32_t storage_get_pin_fails(void)
 {
-    return shadow_config.storage.has_pin_failed_attempts ?
-           shadow_config.storage.pin_failed_attempts : 0;
+    return(storage_pin_count(storage_pin_word()));
 }
 
 /*
@@ -776,6 +1327,176 @@ bool storage_get_root_node(HDNode *node)
     return false;
 }
 
+/*
+ * storage_account_node_cacheable() - Can node for path be kept in the
+ * persistent account node cache
+ *
+ * INPUT
+ *     - address_n: path of at least ACCOUNT_CACHE_DEPTH elements
+ * OUTPUT
+ *     true/false
+ *
+ */
+bool storage_account_node_cacheable(const uint32_t *address_n)
+{
+    uint32_t i;
+
+    /* Passphrase changes the seed, so there is nothing persistent to cache */
+    if(!(shadow_config.storage.has_mnemonic || shadow_config.storage.has_node) ||
+            storage_get_passphrase_protected())
+    {
+        return(false);
+    }
+
+    for(i = 0; i < ACCOUNT_CACHE_DEPTH; i++)
+    {
+        if(!(address_n[i] & 0x80000000))
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/*
+ * storage_get_account_node() - Get account level node from persistent cache
+ *
+ * INPUT
+ *     - address_n: path of at least ACCOUNT_CACHE_DEPTH elements
+ *     - node: node to be filled with cached account node
+ * OUTPUT
+ *     true if found in cache
+ *
+ */
+bool storage_get_account_node(const uint32_t *address_n, HDNode *node)
+{
+    AccountCache *entry = NULL, plain;
+    uint8_t keys[64], mac[SHA256_DIGEST_LENGTH], iv[sizeof(plain.mac)];
+    aes_decrypt_ctx ctx;
+    bool ret_val;
+    uint32_t i;
+
+    if(!storage_account_node_cacheable(address_n))
+    {
+        return(false);
+    }
+
+    for(i = 0; i < ACCOUNT_CACHE_SIZE; i++)
+    {
+        if(shadow_config.cache.account_cache[i].status == CACHE_EXISTS &&
+                memcmp(shadow_config.cache.account_cache[i].address_n, address_n,
+                       sizeof(entry->address_n)) == 0)
+        {
+            entry = &shadow_config.cache.account_cache[i];
+            break;
+        }
+    }
+
+    if(entry == NULL)
+    {
+        return(false);
+    }
+
+    memcpy(&plain, entry, sizeof(plain));
+    memset(plain.mac, 0, sizeof(plain.mac));
+    memcpy(iv, entry->mac, sizeof(iv));
+
+    storage_account_cache_keys(keys);
+    aes_decrypt_key256(keys, &ctx);
+    aes_cbc_decrypt(plain.secret, plain.secret, sizeof(plain.secret), iv, &ctx);
+    hmac_sha256(keys + 32, 32, (const uint8_t *)&plain, sizeof(plain), mac);
+
+    ret_val = (memcmp(mac, entry->mac, sizeof(entry->mac)) == 0);
+
+    if(ret_val)
+    {
+        node->depth = plain.depth;
+        node->fingerprint = plain.fingerprint;
+        node->child_num = address_n[ACCOUNT_CACHE_DEPTH - 1];
+        memcpy(node->chain_code, plain.secret, sizeof(node->chain_code));
+        memcpy(node->private_key, plain.secret + sizeof(node->chain_code),
+               sizeof(node->private_key));
+        memcpy(node->public_key, plain.public_key, sizeof(node->public_key));
+    }
+
+    memset(&plain, 0, sizeof(plain));
+    memset(keys, 0, sizeof(keys));
+    memset(&ctx, 0, sizeof(ctx));
+    return(ret_val);
+}
+
+/*
+ * storage_set_account_node() - Add account level node to persistent cache
+ *
+ * INPUT
+ *     - address_n: path of at least ACCOUNT_CACHE_DEPTH elements
+ *     - node: account node derived from path
+ * OUTPUT
+ *     none
+ *
+ */
+void storage_set_account_node(const uint32_t *address_n, const HDNode *node)
+{
+    AccountCache *entry = NULL, plain;
+    uint8_t keys[64], mac[SHA256_DIGEST_LENGTH];
+    aes_encrypt_ctx ctx;
+    uint32_t i;
+
+    if(!storage_account_node_cacheable(address_n))
+    {
+        return;
+    }
+
+    for(i = 0; i < ACCOUNT_CACHE_SIZE; i++)
+    {
+        if(shadow_config.cache.account_cache[i].status != CACHE_EXISTS)
+        {
+            if(entry == NULL)
+            {
+                entry = &shadow_config.cache.account_cache[i];
+            }
+        }
+        else if(memcmp(shadow_config.cache.account_cache[i].address_n, address_n,
+                       sizeof(entry->address_n)) == 0)
+        {
+            return;
+        }
+    }
+
+    /* Cache keeps the first accounts used, replacing one would erase a sector */
+    if(entry == NULL)
+    {
+        return;
+    }
+
+    memset(&plain, 0, sizeof(plain));
+    plain.status = CACHE_EXISTS;
+    plain.depth = node->depth;
+    memcpy(plain.address_n, address_n, sizeof(plain.address_n));
+    plain.fingerprint = node->fingerprint;
+    memcpy(plain.public_key, node->public_key, sizeof(plain.public_key));
+    memcpy(plain.secret, node->chain_code, sizeof(node->chain_code));
+    memcpy(plain.secret + sizeof(node->chain_code), node->private_key,
+           sizeof(node->private_key));
+
+    storage_account_cache_keys(keys);
+    hmac_sha256(keys + 32, 32, (const uint8_t *)&plain, sizeof(plain), mac);
+    memcpy(plain.mac, mac, sizeof(plain.mac));
+
+    /* Encryption modifies the IV, the mac was already saved above */
+    aes_encrypt_key256(keys, &ctx);
+    aes_cbc_encrypt(plain.secret, plain.secret, sizeof(plain.secret), mac, &ctx);
+
+    memcpy(entry, &plain, sizeof(plain));
+
+    memset(&plain, 0, sizeof(plain));
+    memset(keys, 0, sizeof(keys));
+    memset(&ctx, 0, sizeof(ctx));
+
+    storage_commit();
+}
+
 /*
  * storage_is_initialized() - Is device initialized?
  *
@@ -108,6 +108,20 @@ uint32_t op_push(uint32_t i, uint8_t *out) {
 	return 5;
 }
 
+uint32_t op_push_size(uint32_t i)
+{
+	if (i < 0x4C) {
+		return 1;
+	}
+	if (i < 0xFF) {
+		return 2;
+	}
+	if (i < 0xFFFF) {
+		return 3;
+	}
+	return 5;
+}
+
 int compile_output(const CoinType *coin, const HDNode *root, TxOutputType *in, TxOutputBinType *out, bool needs_confirm)
 {
 	memset(out, 0, sizeof(TxOutputBinType));
@@ -259,12 +273,12 @@ uint32_t compile_script_multisig(const MultisigRedeemScriptType *multisig, uint8
 	if (n < 1 || n > 15) return 0;
 	uint32_t i, r = 0;
 	if (out) {
+		const MultisigDescriptor *descriptor = cryptoMultisigDescriptor(multisig);
+		if (!descriptor) return 0;
 		out[r] = 0x50 + m; r++;
 		for (i = 0; i < n; i++) {
 			out[r] = 33; r++; // OP_PUSH 33
-			const uint8_t *pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
-			if (!pubkey) return 0;
-			memcpy(out + r, pubkey, 33); r += 33;
+			memcpy(out + r, descriptor->pubkeys[i], 33); r += 33;
 		}
 		out[r] = 0x50 + n; r++;
 		out[r] = 0xAE; r++; // OP_CHECKMULTISIG
@@ -276,30 +290,9 @@ uint32_t compile_script_multisig(const MultisigRedeemScriptType *multisig, uint8
 
 uint32_t compile_script_multisig_hash(const MultisigRedeemScriptType *multisig, uint8_t *hash)
 {
-	if (!multisig->has_m) return 0;
-	const uint32_t m = multisig->m;
-	const uint32_t n = multisig->pubkeys_count;
-	if (m < 1 || m > 15) return 0;
-	if (n < 1 || n > 15) return 0;
-
-	SHA256_CTX ctx;
-	sha256_Init(&ctx);
-
-	uint8_t d[2];
-	d[0] = 0x50 + m; sha256_Update(&ctx, d, 1);
-	uint32_t i;
-	for (i = 0; i < n; i++) {
-		d[0] = 33; sha256_Update(&ctx, d, 1); // OP_PUSH 33
-		const uint8_t *pubkey = cryptoHDNodePathToPubkey(&(multisig->pubkeys[i]));
-		if (!pubkey) return 0;
-		sha256_Update(&ctx, pubkey, 33);
-	}
-	d[0] = 0x50 + n;
-	d[1] = 0xAE;
-	sha256_Update(&ctx, d, 2);
-
-	sha256_Final(hash, &ctx);
-
+	const MultisigDescriptor *descriptor = cryptoMultisigDescriptor(multisig);
+	if (!descriptor) return 0;
+	memcpy(hash, descriptor->script_hash, 32);
 	return 1;
 }
 
@@ -335,6 +328,80 @@ uint32_t serialize_script_multisig(const MultisigRedeemScriptType *multisig, uin
 	return r;
 }
 
+/* --- Checksum Methods ---------------------------------------------------- */
+
+static void check_hash_u32(SHA256_CTX *ctx, uint32_t v)
+{
+	sha256_Update(ctx, (const uint8_t *)&v, sizeof(uint32_t));
+}
+
+static void check_hash_bytes(SHA256_CTX *ctx, const uint8_t *bytes, uint32_t size)
+{
+	check_hash_u32(ctx, size);
+	sha256_Update(ctx, bytes, size);
+}
+
+static void check_hash_path(SHA256_CTX *ctx, const uint32_t *address_n, uint32_t address_n_count)
+{
+	uint32_t i;
+	check_hash_u32(ctx, address_n_count);
+	for (i = 0; i < address_n_count; i++) {
+		check_hash_u32(ctx, address_n[i]);
+	}
+}
+
+static void check_hash_multisig(SHA256_CTX *ctx, const MultisigRedeemScriptType *multisig)
+{
+	uint32_t i;
+	check_hash_u32(ctx, multisig->has_m);
+	check_hash_u32(ctx, multisig->m);
+	check_hash_u32(ctx, multisig->pubkeys_count);
+	for (i = 0; i < multisig->pubkeys_count; i++) {
+		const HDNodePathType *path = &(multisig->pubkeys[i]);
+		check_hash_u32(ctx, path->node.depth);
+		check_hash_u32(ctx, path->node.fingerprint);
+		check_hash_u32(ctx, path->node.child_num);
+		check_hash_bytes(ctx, path->node.chain_code.bytes, path->node.chain_code.size);
+		check_hash_u32(ctx, path->node.has_private_key);
+		check_hash_bytes(ctx, path->node.private_key.bytes, path->node.private_key.size);
+		check_hash_u32(ctx, path->node.has_public_key);
+		check_hash_bytes(ctx, path->node.public_key.bytes, path->node.public_key.size);
+		check_hash_path(ctx, path->address_n, path->address_n_count);
+	}
+	check_hash_u32(ctx, multisig->signatures_count);
+	for (i = 0; i < multisig->signatures_count; i++) {
+		check_hash_bytes(ctx, multisig->signatures[i].bytes, multisig->signatures[i].size);
+	}
+}
+
+/*
+ * tx_input_check_hash() - Adds the decoded fields of an input to a
+ * transaction checksum, leaving out unused buffer space and padding
+ */
+void tx_input_check_hash(SHA256_CTX *ctx, const TxInputType *input)
+{
+	check_hash_path(ctx, input->address_n, input->address_n_count);
+	check_hash_bytes(ctx, input->prev_hash.bytes, input->prev_hash.size);
+	check_hash_u32(ctx, input->prev_index);
+	check_hash_u32(ctx, input->has_script_sig);
+	check_hash_bytes(ctx, input->script_sig.bytes, input->script_sig.size);
+	check_hash_u32(ctx, input->sequence);
+	check_hash_u32(ctx, input->script_type);
+	check_hash_u32(ctx, input->has_multisig);
+	if (input->has_multisig) {
+		check_hash_multisig(ctx, &(input->multisig));
+	}
+}
+
+/*
+ * tx_output_check_hash() - Adds a compiled output to a transaction checksum
+ */
+void tx_output_check_hash(SHA256_CTX *ctx, const TxOutputBinType *output)
+{
+	sha256_Update(ctx, (const uint8_t *)&(output->amount), sizeof(uint64_t));
+	check_hash_bytes(ctx, output->script_pubkey.bytes, output->script_pubkey.size);
+}
+
 /* --- Transfer Methods ---------------------------------------------------- */
 
 uint32_t tx_serialize_header(TxStruct *tx, uint8_t *out)
@@ -376,6 +443,13 @@ uint32_t tx_serialize_input(TxStruct *tx, const TxInputType *input, uint8_t *out
 }
 
 uint32_t tx_serialize_input_hash(TxStruct *tx, const TxInputType *input)
+{
+	return tx_serialize_prevout_hash(tx, input->prev_hash.bytes, input->prev_index,
+	                                 input->script_sig.bytes, input->script_sig.size, input->sequence);
+}
+
+uint32_t tx_serialize_prevout_hash(TxStruct *tx, const uint8_t *prev_hash, uint32_t prev_index,
+                                   const uint8_t *script_sig, uint32_t script_sig_size, uint32_t sequence)
 {
 	int i;
 	if (tx->have_inputs >= tx->inputs_len) {
@@ -387,13 +461,13 @@ uint32_t tx_serialize_input_hash(TxStruct *tx, const TxInputType *input)
 		r += tx_serialize_header_hash(tx);
 	}
 	for (i = 0; i < 32; i++) {
-		sha256_Update(&(tx->ctx), &(input->prev_hash.bytes[31 - i]), 1);
+		sha256_Update(&(tx->ctx), &(prev_hash[31 - i]), 1);
 	}
 	r += 32;
-	sha256_Update(&(tx->ctx), (const uint8_t *)&input->prev_index, 4); r += 4;
-	r += ser_length_hash(&(tx->ctx), input->script_sig.size);
-	sha256_Update(&(tx->ctx), input->script_sig.bytes, input->script_sig.size); r += input->script_sig.size;
-	sha256_Update(&(tx->ctx), (const uint8_t *)&input->sequence, 4); r += 4;
+	sha256_Update(&(tx->ctx), (const uint8_t *)&prev_index, 4); r += 4;
+	r += ser_length_hash(&(tx->ctx), script_sig_size);
+	sha256_Update(&(tx->ctx), script_sig, script_sig_size); r += script_sig_size;
+	sha256_Update(&(tx->ctx), (const uint8_t *)&sequence, 4); r += 4;
 
 	tx->have_inputs++;
 	tx->size += r;
@@ -511,12 +585,66 @@ void tx_hash_final(TxStruct *t, uint8_t *hash, bool reverse)
 	}
 }
 
+/* --- Size Methods -------------------------------------------------------- */
+
+static uint32_t input_size(uint32_t script_sig_size)
+{
+	return 32 + 4 + ser_length_size(script_sig_size) + script_sig_size + 4;
+}
+
+static uint32_t output_size(uint32_t script_pubkey_size)
+{
+	return 8 + ser_length_size(script_pubkey_size) + script_pubkey_size;
+}
+
+static uint32_t p2pkh_script_sig_size(void)
+{
+	return op_push_size(TX_SIGNATURE_MAX_SIZE) + TX_SIGNATURE_MAX_SIZE +
+	       op_push_size(TX_PUBKEY_SIZE) + TX_PUBKEY_SIZE;
+}
+
+// version, input and output counts, lock time
+uint32_t tx_header_size(uint32_t inputs_len, uint32_t outputs_len)
+{
+	return 4 + ser_length_size(inputs_len) + ser_length_size(outputs_len) + 4;
+}
+
+// size of the input once signed, taking every signature at its maximum length
+uint32_t tx_input_size(const TxInputType *input)
+{
+	uint32_t script_len;
+	if (input->script_type == InputScriptType_SPENDMULTISIG) {
+		if (!input->has_multisig) return 0;
+		uint32_t redeem_len = compile_script_multisig(&(input->multisig), 0);
+		if (redeem_len == 0) return 0;
+		script_len = 1; // OP_0
+		script_len += input->multisig.m * (op_push_size(TX_SIGNATURE_MAX_SIZE) + TX_SIGNATURE_MAX_SIZE);
+		script_len += op_push_size(redeem_len) + redeem_len;
+	} else {
+		script_len = p2pkh_script_sig_size();
+	}
+	return input_size(script_len);
+}
+
+uint32_t tx_output_size(const TxOutputBinType *output)
+{
+	return output_size(output->script_pubkey.size);
+}
+
+// only the counts are known, assume pay-to-pubkey-hash inputs and outputs
 uint32_t transactionEstimateSize(uint32_t inputs, uint32_t outputs)
 {
-	return 10 + inputs * 149 + outputs * 35;
+	return tx_header_size(inputs, outputs) +
+	       inputs * input_size(p2pkh_script_sig_size()) +
+	       outputs * output_size(TX_P2PKH_SCRIPT_SIZE);
 }
 
 uint32_t transactionEstimateSizeKb(uint32_t inputs, uint32_t outputs)
 {
-	return (transactionEstimateSize(inputs, outputs) + 999) / 1000;
+	return transactionSizeKb(transactionEstimateSize(inputs, outputs));
+}
+
+uint32_t transactionSizeKb(uint32_t size)
+{
+	return (size + 999) / 1000;
 }
@@ -84,6 +84,7 @@
 #define QR_DISPLAY_SCALE        1
 #define QR_DISPLAY_X            4
 #define QR_DISPLAY_Y            10
+#define QR_CACHE_ADDRESS_LEN    128     /* Longest address whose QR code is kept */
 
 /* === Typedefs ============================================================ */
 
@@ -31,9 +31,25 @@
 #include <pb.h>
 #include <interface.h>
 
+/* === Defines ============================================================= */
+
+#define MULTISIG_MAX_PUBKEYS    15
+#define MULTISIG_CACHE_ENTRIES  2
+
+/* === Typedefs ============================================================ */
+
+/* Compiled form of a multisig redeem script, cached for the signing session */
+typedef struct
+{
+    uint32_t pubkeys_count;
+    uint8_t pubkeys[MULTISIG_MAX_PUBKEYS][33];
+    uint8_t script_hash[32];
+} MultisigDescriptor;
+
 /* === Functions =========================================================== */
 
 uint32_t ser_length(uint32_t len, uint8_t *out);
+uint32_t ser_length_size(uint32_t len);
 uint32_t ser_length_hash(SHA256_CTX *ctx, uint32_t len);
 int sshMessageSign(const uint8_t *message, size_t message_len, const uint8_t *privkey, uint8_t *signature);
 int cryptoMessageSign(const uint8_t *message, size_t message_len, const uint8_t *privkey,
@@ -52,6 +68,8 @@ uint8_t *cryptoHDNodePathToPubkey(const HDNodePathType *hdnodepath);
 int cryptoMultisigPubkeyIndex(const MultisigRedeemScriptType *multisig,
                               const uint8_t *pubkey);
 int cryptoMultisigFingerprint(const MultisigRedeemScriptType *multisig, uint8_t *hash);
+const MultisigDescriptor *cryptoMultisigDescriptor(const MultisigRedeemScriptType *multisig);
+void cryptoMultisigCacheClear(void);
 int cryptoIdentityFingerprint(const IdentityType *identity, uint8_t *hash);
 
 #endif
@@ -23,12 +23,13 @@
 /* === Includes ============================================================ */
 
 #include <interface.h>
+#include <msg_arena.h>
 
 /* === Defines ============================================================= */
 
 #define RESP_INIT(TYPE) \
-    TYPE *resp = (TYPE *)msg_resp; \
-    _Static_assert(sizeof(msg_resp) >= sizeof(TYPE), #TYPE" is too large"); \
+    TYPE *resp = (TYPE *)msg_arena_response(sizeof(TYPE)); \
+    _Static_assert(MSG_RESP_SIZE >= sizeof(TYPE), #TYPE" is too large"); \
     memset(resp, 0, sizeof(TYPE));
 
 #define ENTROPY_BUF sizeof(((Entropy *)NULL)->entropy.bytes)
@@ -78,6 +79,7 @@ void fsm_msgCharacterAck(CharacterAck *msg);
 //void fsm_msgDebugLinkDecision(DebugLinkDecision *msg);
 void fsm_msgDebugLinkGetState(DebugLinkGetState *msg);
 void fsm_msgDebugLinkStop(DebugLinkStop *msg);
+void fsm_msgDebugLinkGetStats(DebugLinkGetStats *msg);
 #endif
 
 #endif
@@ -35,6 +35,11 @@
  */
 #define PROGRESS_PRECISION 16
 
+/* RAM set aside for replaying phase 2 of a signing session without
+ * re-streaming the whole transaction for every input.
+ */
+#define SIGNING_BATCH_BUFFER_SIZE 4096
+
 /* === Functions =========================================================== */
 
 void signing_init(uint32_t _inputs_count, uint32_t _outputs_count, const CoinType *_coin,
@@ -30,11 +30,60 @@
 
 /* === Defines ============================================================= */
 
-#define STORAGE_VERSION 1
+#define STORAGE_VERSION 2
 #define PBKDF2_HMAC_SHA512_SALT "TREZORHD"
 
 #define STORAGE_RETRIES 3
 
+/*
+ * Commits that only change a few fields are appended as patch records after
+ * the ConfigFlash snapshot at the start of the active storage sector. The
+ * sector is only erased and a new snapshot written to the next sector when
+ * the log is full or a change would leave old secrets behind in flash.
+ */
+#define STORAGE_LOG_START       sizeof(ConfigFlash)
+#define STORAGE_LOG_END         STORAGE_PIN_AREA_START
+
+/*
+ * Version 1 snapshots end where the account node cache starts. Their log
+ * follows straight after and may run to the end of the sector, over the PIN
+ * failure counter area, when written by firmware that predates the area.
+ */
+#define STORAGE_V1_CONFIG_LEN   offsetof(ConfigFlash, cache.account_cache)
+#define STORAGE_V1_LOG_END      STOR_FLASH_SECT_LEN
+#define STORAGE_RECORD_SIZE(len) (sizeof(StorageRecord) + (len) + sizeof(uint32_t))
+
+/* Unchanged words merged into a record rather than starting a new one */
+#define STORAGE_RECORD_GAP      ((sizeof(StorageRecord) + sizeof(uint32_t)) / sizeof(uint32_t))
+
+/*
+ * PIN failures are counted in a separate area at the end of the storage
+ * sector. Each word holds one count: bit 31 is set while the word is open and
+ * every failure clears the next of bits 0-30. A successful PIN closes the word
+ * by programming it to zero, so nothing is erased until all words are used.
+ */
+#define STORAGE_PIN_AREA_LEN    256
+#define STORAGE_PIN_AREA_START  (STOR_FLASH_SECT_LEN - STORAGE_PIN_AREA_LEN)
+#define STORAGE_PIN_WORDS       (STORAGE_PIN_AREA_LEN / sizeof(uint32_t))
+#define STORAGE_PIN_OPEN        0x80000000
+#define STORAGE_PIN_FAILS_MAX   31
+
+/* === Typedefs ============================================================ */
+
+/* Log record header, followed by len bytes of patch data and a crc32 */
+typedef struct
+{
+    uint16_t offset;    /* Offset of patched bytes in ConfigFlash */
+    uint16_t len;       /* Number of patched bytes, multiple of 4 */
+} StorageRecord;
+
+/* Region of ConfigFlash */
+typedef struct
+{
+    uint32_t offset;
+    uint32_t len;
+} StorageRegion;
+
 /* === Functions =========================================================== */
 
 void storage_init(void);
@@ -46,6 +95,9 @@ void storage_commit(void);
 void storage_load_device(LoadDevice *msg);
 
 bool storage_get_root_node(HDNode *node);
+bool storage_account_node_cacheable(const uint32_t *address_n);
+bool storage_get_account_node(const uint32_t *address_n, HDNode *node);
+void storage_set_account_node(const uint32_t *address_n, const HDNode *node);
 
 void storage_set_label(const char *label);
 const char *storage_get_label(void);
@@ -28,6 +28,12 @@
 #include <bip32.h>
 #include <interface.h>
 
+/* === Defines ============================================================= */
+
+#define TX_SIGNATURE_MAX_SIZE   73  /* DER signature plus sighash type byte */
+#define TX_PUBKEY_SIZE          33
+#define TX_P2PKH_SCRIPT_SIZE    25
+
 /* === Typedefs ============================================================ */
 
 typedef struct {
@@ -53,16 +59,26 @@ uint32_t compile_script_multisig_hash(const MultisigRedeemScriptType *multisig,
 uint32_t serialize_script_sig(const uint8_t *signature, uint32_t signature_len, const uint8_t *pubkey, uint32_t pubkey_len, uint8_t *out);
 uint32_t serialize_script_multisig(const MultisigRedeemScriptType *multisig, uint8_t *out);
 int compile_output(const CoinType *coin, const HDNode *root, TxOutputType *in, TxOutputBinType *out, bool needs_confirm);
+void tx_input_check_hash(SHA256_CTX *ctx, const TxInputType *input);
+void tx_output_check_hash(SHA256_CTX *ctx, const TxOutputBinType *output);
 uint32_t tx_serialize_input(TxStruct *tx, const TxInputType *input, uint8_t *out);
 uint32_t tx_serialize_output(TxStruct *tx, const TxOutputBinType *output, uint8_t *out);
 
 void tx_init(TxStruct *tx, uint32_t inputs_len, uint32_t outputs_len, uint32_t version, uint32_t lock_time, bool add_hash_type);
 uint32_t tx_serialize_input_hash(TxStruct *tx, const TxInputType *input);
+uint32_t tx_serialize_prevout_hash(TxStruct *tx, const uint8_t *prev_hash, uint32_t prev_index,
+                                   const uint8_t *script_sig, uint32_t script_sig_size, uint32_t sequence);
 uint32_t tx_serialize_output_hash(TxStruct *tx, const TxOutputBinType *output);
 void tx_hash_final(TxStruct *t, uint8_t *hash, bool reverse);
 
+uint32_t tx_header_size(uint32_t inputs_len, uint32_t outputs_len);
+uint32_t tx_input_size(const TxInputType *input);
+uint32_t tx_output_size(const TxOutputBinType *output);
+
 uint32_t transactionEstimateSize(uint32_t inputs, uint32_t outputs);
 
 uint32_t transactionEstimateSizeKb(uint32_t inputs, uint32_t outputs);
 
+uint32_t transactionSizeKb(uint32_t size);
+
 #endif
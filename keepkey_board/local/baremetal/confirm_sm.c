@@ -296,8 +296,11 @@ static bool confirm_helper(const char *request_title, const char *request_body,
 
 #endif
 
-        display_refresh();
         animate();
+        display_refresh();
+
+        /* Sleep until a button, USB or timer event needs handling */
+        wait_for_event(EVENT_BUTTON | EVENT_USB | EVENT_TIMER);
     }
 
 confirm_helper_exit:
@@ -20,124 +20,281 @@
 /* === Includes ============================================================ */
 
 #include <stddef.h>
+#include <string.h>
 
 #include "draw.h"
+#include "layout.h"
 #include "keepkey_display.h"
 #include "font.h"
 #include "resources.h"
 
-/* === Functions =========================================================== */
+/* === Defines ============================================================= */
+
+#define TEXT_LAYOUT_MAX_GLYPHS  (BODY_CHAR_MAX - 1)  /* Fits the longest notification body */
+#define TEXT_LAYOUT_CACHE_SIZE  2                    /* Title and body of a screen */
+
+/* === Private Variables =================================================== */
+
+/* Placement of one glyph relative to the text origin */
+typedef struct
+{
+    uint8_t index;      /* Character index in font */
+    uint8_t line;
+    uint8_t x;          /* Glyphs past the display width are not kept */
+} TextGlyph;
+
+/* Line breaks and glyph positions of a string, computed once per string */
+typedef struct
+{
+    const Font *font;
+    int         width;
+    int         line_height;
+    uint16_t    glyph_count;
+    uint16_t    line_count;
+    char        text[BODY_CHAR_MAX];
+    TextGlyph   glyphs[TEXT_LAYOUT_MAX_GLYPHS];
+} TextLayout;
+
+static TextLayout layout_cache[TEXT_LAYOUT_CACHE_SIZE];
+static uint32_t layout_cache_next = 0;
+
+/* === Private Functions =================================================== */
 
 /*
- * draw_char_with_shift() - Draw image on display with left/top margins
+ * draw_pixel() - Set one pixel in a row of packed canvas pixels
+ *
+ * INPUT
+ *     - row: start of canvas row
+ *     - x: pixel column
+ *     - color: pixel color, high nibble is used
+ * OUTPUT
+ *     none
+ */
+static inline void draw_pixel(uint8_t *row, int x, uint8_t color)
+{
+    uint8_t *pixels = &row[x / 2];
+
+    if(x & 1)
+    {
+        *pixels = (*pixels & 0xF0) | (color >> 4);
+    }
+    else
+    {
+        *pixels = (*pixels & 0x0F) | (color & 0xF0);
+    }
+}
+
+/*
+ * draw_span() - Set a horizontal run of pixels in a row of packed canvas pixels
+ *
+ * INPUT
+ *     - row: start of canvas row
+ *     - x: first column of run
+ *     - count: number of pixels in run
+ *     - color: pixel color, high nibble is used
+ * OUTPUT
+ *     none
+ */
+static void draw_span(uint8_t *row, int x, int count, uint8_t color)
+{
+    int end = x + count;
+    int bytes;
+
+    /* Odd leading pixel shares a byte with its left neighbour */
+    if((x & 1) && x < end)
+    {
+        draw_pixel(row, x, color);
+        x++;
+    }
+
+    /* Whole bytes in between are filled at once */
+    bytes = (end > x) ? (end - x) / 2 : 0;
+    memset(&row[ x / 2 ], (color & 0xF0) | (color >> 4), bytes);
+    x += bytes * 2;
+
+    if(x < end)
+    {
+        draw_pixel(row, x, color);
+    }
+}
+
+/*
+ * draw_mark_dirty() - Grow canvas dirty rectangle to cover an area
  *
  * INPUT
  *     - canvas: canvas
- *     - p: pointer to Margins and text color
- *     - x_shift: left margin
- *     - y_shift: top margin
- *     - img: pointer to image drawn on the screen
+ *     - x: left of area
+ *     - y: top of area
+ *     - width: width of area
+ *     - height: height of area
  * OUTPUT
- *      true/false whether image was drawn
+ *     none
  */
-bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
-                          int *x_shift, int *y_shift, const CharacterImage *img)
+static void draw_mark_dirty(Canvas *canvas, int x, int y, int width, int height)
 {
-    bool ret_stat = false;
+    int x1 = x + width - 1;
+    int y1 = y + height - 1;
+
+    x = (x < 0) ? 0 : x;
+    y = (y < 0) ? 0 : y;
+    x1 = (x1 >= canvas->width) ? canvas->width - 1 : x1;
+    y1 = (y1 >= canvas->height) ? canvas->height - 1 : y1;
+
+    if(x > x1 || y > y1)
+    {
+        return;
+    }
 
-    int start_index = (p->y * canvas->width) + p->x;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
+    if(!canvas->dirty)
+    {
+        canvas->dirty_x0 = x;
+        canvas->dirty_y0 = y;
+        canvas->dirty_x1 = x1;
+        canvas->dirty_y1 = y1;
+        canvas->dirty = true;
+    }
+    else
+    {
+        canvas->dirty_x0 = (x < canvas->dirty_x0) ? x : canvas->dirty_x0;
+        canvas->dirty_y0 = (y < canvas->dirty_y0) ? y : canvas->dirty_y0;
+        canvas->dirty_x1 = (x1 > canvas->dirty_x1) ? x1 : canvas->dirty_x1;
+        canvas->dirty_y1 = (y1 > canvas->dirty_y1) ? y1 : canvas->dirty_y1;
+    }
+}
+
+/*
+ * draw_glyph() - Draw a packed character image as spans of text color
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left of character
+ *     - y: top of character
+ *     - img: character image
+ *     - color: text color
+ * OUTPUT
+ *     true/false whether character was drawn
+ */
+static bool draw_glyph(Canvas *canvas, int x, int y, const CharacterImage *img,
+                       uint8_t color)
+{
+    const uint8_t *img_row;
+    uint8_t *row;
+    int row_bytes, y0;
 
     /* Check that this was a character that we have in the font */
-    if(img != NULL)
+    if(img == NULL)
     {
+        return(false);
+    }
 
-        /* Check that it's within bounds. */
-        if(((img->width + p->x) <= canvas->width) &&
-                ((img->height + p->y) <= canvas->height))
-        {
-            const uint8_t *img_pixel = &img->data[ 0 ];
+    /* Check that it's within bounds. */
+    if(((img->width + x) > canvas->width) || ((img->height + y) > canvas->height))
+    {
+        return(false);
+    }
 
-            int y;
+    img_row = img->data;
+    row = &canvas->buffer[ y * CANVAS_STRIDE(canvas) ];
+    row_bytes = FONT_ROW_BYTES(img);
 
-            for(y = 0; y < img->height; y++)
-            {
-                int x;
+    for(y0 = 0; y0 < img->height; y0++)
+    {
+        uint32_t bits = 0;
+        int i, col = 0;
 
-                for(x = 0; x < img->width; x++)
-                {
-                    *canvas_pixel = (*img_pixel == 0x00) ? p->color : *canvas_pixel;
-                    canvas_pixel++;
-                    img_pixel++;
-                }
+        for(i = 0; i < row_bytes; i++)
+        {
+            bits = (bits << 8) | img_row[ i ];
+        }
 
-                canvas_pixel += (canvas->width - img->width);
-            }
+        /* Left align so the first pixel is the top bit */
+        bits <<= 32 - 8 * row_bytes;
 
-            if(x_shift != NULL)
-            {
-                *x_shift += img->width;
-            }
+        while(bits)
+        {
+            int run;
 
-            if(y_shift != NULL)
-            {
-                *y_shift += img->height;
-            }
+            /* Skip background pixels then fill the run of set ones */
+            run = __builtin_clz(bits);
+            bits <<= run;
+            col += run;
 
-            ret_stat = true;
+            run = __builtin_clz(~bits);
+            draw_span(row, x + col, run, color);
+            bits <<= run;
+            col += run;
         }
+
+        img_row += row_bytes;
+        row += CANVAS_STRIDE(canvas);
     }
 
-    canvas->dirty = true;
+    draw_mark_dirty(canvas, x, y, img->width, img->height);
 
-    return(ret_stat);
+    return(true);
 }
 
 /*
- * draw_string() - Draw string with provided font
+ * text_layout_init() - Compute line breaks and glyph positions of a string
  *
  * INPUT
- *     - canvas: canvas
+ *     - layout: layout to fill in
  *     - font: pointer to font size
- *     - str_write: pointer to string to shown on display
- *     - p: pointer to Margins and text color
- *     - width: row width allocated for drawing
- *     - line_height: offset from top of screen
+ *     - str: string to lay out, truncated to TEXT_LAYOUT_MAX_GLYPHS characters
+ *     - width: row width allocated for drawing, 0 for no wrapping
+ *     - line_height: offset between lines
  * OUTPUT
  *     none
  */
-void draw_string(Canvas *canvas, const Font *font, const char *str_write,
-                 DrawableParams *p, int width, int line_height)
+static void text_layout_init(TextLayout *layout, const Font *font, const char *str,
+                             int width, int line_height)
 {
-    bool have_space = true;
+    const char *c;
     int x_offset = 0;
-    DrawableParams char_params = *p;
+    int line = 0;
 
-    while(*str_write && have_space)
+    layout->font = font;
+    layout->width = width;
+    layout->line_height = line_height;
+    layout->glyph_count = 0;
+    strlcpy(layout->text, str, sizeof(layout->text));
+
+    for(c = layout->text; *c && line <= UINT8_MAX; c++)
     {
-        const CharacterImage *img = font_get_char(font, *str_write);
-        int word_width = img->width;
-        char *next_c = (char *)str_write + 1;
+        int index, word_width;
+        TextGlyph *glyph;
 
         /* Allow line breaks */
-        if(*str_write == '\n')
+        if(*c == '\n')
         {
-            char_params.y += line_height;
+            line++;
             x_offset = 0;
-            str_write++;
             continue;
         }
 
+        /* Drawing stops at the first character missing from the font */
+        index = font_get_char_index(font, *c);
+
+        if(index < 0)
+        {
+            break;
+        }
+
+        word_width = font->characters[ index ].image->width;
+
         /*
          * Calculate the next word width while
          * removing spacings at beginning of lines
          */
-        if(*str_write == ' ')
+        if(*c == ' ')
         {
+            const char *next_c = c + 1;
 
             while(*next_c && *next_c != ' ' && *next_c != '\n')
             {
-                word_width += font_get_char(font, *next_c)->width;
+                const CharacterImage *img = font_get_char(font, *next_c);
+
+                word_width += (img != NULL) ? img->width : 0;
                 next_c++;
             }
         }
@@ -145,24 +302,151 @@ void draw_string(Canvas *canvas, const Font *font, const char *str_write,
         /* Determine if we need a line break */
         if((width != 0) && (x_offset + word_width > width))
         {
-            char_params.y += line_height;
+            line++;
             x_offset = 0;
         }
 
         /* Remove spaces from beginning of of line */
-        if(x_offset == 0 && *str_write == ' ')
+        if(x_offset == 0 && *c == ' ')
         {
-            str_write++;
             continue;
         }
 
-        /* Draw Character */
-        char_params.x = x_offset + p->x;
-        have_space = draw_char_with_shift(canvas, &char_params, &x_offset, NULL, img);
-        str_write++;
+        /* Nothing past the widest row can be seen */
+        if(x_offset > UINT8_MAX)
+        {
+            continue;
+        }
+
+        glyph = &layout->glyphs[ layout->glyph_count++ ];
+        glyph->index = index;
+        glyph->line = line;
+        glyph->x = x_offset;
+
+        x_offset += font->characters[ index ].image->width;
     }
 
-    canvas->dirty = true;
+    layout->line_count = line + 1;
+}
+
+/*
+ * text_layout_get() - Get layout of a string, reusing a cached one when the
+ * same string was laid out recently
+ *
+ * INPUT
+ *     - font: pointer to font size
+ *     - str: string to lay out
+ *     - width: row width allocated for drawing, 0 for no wrapping
+ *     - line_height: offset between lines
+ * OUTPUT
+ *     text layout
+ */
+static const TextLayout *text_layout_get(const Font *font, const char *str, int width,
+                                         int line_height)
+{
+    TextLayout *layout;
+    int i;
+
+    /* Strings are compared by content since callers reuse their buffers */
+    for(i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        layout = &layout_cache[ i ];
+
+        if(layout->font == font && layout->width == width &&
+                layout->line_height == line_height &&
+                strncmp(layout->text, str, TEXT_LAYOUT_MAX_GLYPHS) == 0)
+        {
+            return(layout);
+        }
+    }
+
+    layout = &layout_cache[ layout_cache_next ];
+    layout_cache_next = (layout_cache_next + 1) % TEXT_LAYOUT_CACHE_SIZE;
+    text_layout_init(layout, font, str, width, line_height);
+
+    return(layout);
+}
+
+/*
+ * draw_text_layout() - Draw a laid out string
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - layout: text layout
+ *     - p: pointer to Margins and text color
+ * OUTPUT
+ *     true/false whether all of the string was drawn
+ */
+static bool draw_text_layout(Canvas *canvas, const TextLayout *layout, DrawableParams *p)
+{
+    int i;
+
+    for(i = 0; i < layout->glyph_count; i++)
+    {
+        const TextGlyph *glyph = &layout->glyphs[ i ];
+
+        if(!draw_glyph(canvas, p->x + glyph->x, p->y + glyph->line * layout->line_height,
+                       layout->font->characters[ glyph->index ].image, p->color))
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * draw_char_with_shift() - Draw image on display with left/top margins
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - p: pointer to Margins and text color
+ *     - x_shift: left margin
+ *     - y_shift: top margin
+ *     - img: pointer to image drawn on the screen
+ * OUTPUT
+ *      true/false whether image was drawn
+ */
+bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
+                          int *x_shift, int *y_shift, const CharacterImage *img)
+{
+    bool ret_stat = draw_glyph(canvas, p->x, p->y, img, p->color);
+
+    if(ret_stat)
+    {
+        if(x_shift != NULL)
+        {
+            *x_shift += img->width;
+        }
+
+        if(y_shift != NULL)
+        {
+            *y_shift += img->height;
+        }
+    }
+
+    return(ret_stat);
+}
+
+/*
+ * draw_string() - Draw string with provided font
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - font: pointer to font size
+ *     - str_write: pointer to string to shown on display
+ *     - p: pointer to Margins and text color
+ *     - width: row width allocated for drawing
+ *     - line_height: offset from top of screen
+ * OUTPUT
+ *     none
+ */
+void draw_string(Canvas *canvas, const Font *font, const char *str_write,
+                 DrawableParams *p, int width, int line_height)
+{
+    draw_text_layout(canvas, text_layout_get(font, str_write, width, line_height), p);
 }
 
 /*
@@ -183,8 +467,6 @@ void draw_char(Canvas *canvas, const Font *font, char c, DrawableParams *p)
 
     /* Draw Character */
     draw_char_with_shift(canvas, p, &x_offset, NULL, img);
-
-    canvas->dirty = true;
 }
 
 /*
@@ -231,8 +513,7 @@ void draw_box(Canvas *canvas, BoxDrawableParams *p)
     int end_col = p->base.x + p->width;
     end_col = (end_col >= canvas->width) ? canvas->width - 1 : end_col;
 
-    int start_index = (start_row * canvas->width) + start_col;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
+    uint8_t *row = &canvas->buffer[ start_row * CANVAS_STRIDE(canvas) ];
 
     int height = end_row - start_row;
     int width = end_col - start_col;
@@ -241,18 +522,11 @@ void draw_box(Canvas *canvas, BoxDrawableParams *p)
 
     for(y = 0; y < height; y++)
     {
-        int x;
-
-        for(x = 0; x < width; x++)
-        {
-            *canvas_pixel = p->base.color;
-            canvas_pixel++;
-        }
-
-        canvas_pixel += (canvas->width - width);
+        draw_span(row, start_col, width, p->base.color);
+        row += CANVAS_STRIDE(canvas);
     }
 
-    canvas->dirty = true;
+    draw_mark_dirty(canvas, start_col, start_row, width, height);
 }
 
 /*
@@ -287,64 +561,70 @@ void draw_box_simple(Canvas *canvas, uint8_t color, int x, int y, int width, int
 bool draw_bitmap_mono_rle(Canvas *canvas, DrawableParams *p, const Image *img)
 {
     bool ret_stat = false;
-    int x0, y0;
-    int8_t sequence = 0;
-    int8_t nonsequence = 0;
-    static uint8_t image_data[KEEPKEY_DISPLAY_WIDTH * KEEPKEY_DISPLAY_HEIGHT];
-
-    int start_index = (p->y * canvas->width) + p->x;
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-
-    /* Get image data */
-    img->get_image_data(image_data);
+    const uint8_t *img_data = img->data;
+    uint8_t *row = &canvas->buffer[ p->y * CANVAS_STRIDE(canvas) ];
+    int x = 0, y = 0;
+    int run = 0;
+    bool literal = false;
 
     /* Check that image will fit in bounds */
     if(((img->width + p->x) <= canvas->width) &&
             ((img->height + p->y) <= canvas->height))
     {
-        const uint8_t *img_pixel = &image_data[0];
-
-        for(y0 = 0; y0 < img->height; y0++)
+        while(y < img->height)
         {
-            for(x0 = 0; x0 < img->width; x0++)
+            int count;
+
+            if(run == 0)
+            {
+                int8_t sequence = *img_data++;
+
+                literal = (sequence < 0);
+                run = literal ? -sequence : sequence;
+            }
+
+            if(run == 0)
+            {
+                /* Zero length runs skip a single pixel */
+                count = 1;
+            }
+            else
             {
-                if((sequence == 0) && (nonsequence == 0))
+                /* Runs may continue onto the following row */
+                count = (run < img->width - x) ? run : img->width - x;
+                run -= count;
+
+                if(literal)
                 {
-                    sequence = *img_pixel++;
+                    int i;
 
-                    if(sequence < 0)
+                    for(i = 0; i < count; i++)
                     {
-                        nonsequence = -sequence;
-                        sequence = 0;
+                        draw_pixel(row, p->x + x + i, *img_data++);
                     }
                 }
-
-                if(sequence > 0)
+                else
                 {
-                    *canvas_pixel = *img_pixel;
-
-                    sequence--;
+                    draw_span(row, p->x + x, count, *img_data);
 
-                    if(sequence == 0)
+                    if(run == 0)
                     {
-                        img_pixel++;
+                        img_data++;
                     }
                 }
+            }
 
-                if(nonsequence > 0)
-                {
-                    *canvas_pixel = *img_pixel++;
-
-                    nonsequence--;
-                }
+            x += count;
 
-                canvas_pixel++;
+            if(x == img->width)
+            {
+                x = 0;
+                y++;
+                row += CANVAS_STRIDE(canvas);
             }
-
-            canvas_pixel += (canvas->width - img->width);
         }
 
-        canvas->dirty = true;
+        draw_mark_dirty(canvas, p->x, p->y, img->width, img->height);
         ret_stat = true;
     }
 
@@ -27,156 +27,156 @@
 
 /* --- Pin Font ------------------------------------------------------------ */
 
-static const uint8_t image_data_pin_font_0x31[48] =
-{
-    0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00
+static const uint8_t image_data_pin_font_0x31[12] =
+{
+    0x70,
+    0xf0,
+    0xf0,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30
 };
 static const CharacterImage pin_font_0x31 = { image_data_pin_font_0x31, 4, 12};
 
-static const uint8_t image_data_pin_font_0x32[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+static const uint8_t image_data_pin_font_0x32[12] =
+{
+    0xfc,
+    0xfe,
+    0x03,
+    0x03,
+    0x03,
+    0x3e,
+    0x7c,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xff,
+    0xff
 };
 static const CharacterImage pin_font_0x32 = { image_data_pin_font_0x32, 8, 12};
 
-static const uint8_t image_data_pin_font_0x33[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x33[12] =
+{
+    0xfc,
+    0xfe,
+    0x03,
+    0x03,
+    0x03,
+    0x7e,
+    0x7e,
+    0x03,
+    0x03,
+    0x03,
+    0xfe,
+    0xfc
 };
 static const CharacterImage pin_font_0x33 = { image_data_pin_font_0x33, 8, 12};
 
-static const uint8_t image_data_pin_font_0x34[96] =
-{
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
+static const uint8_t image_data_pin_font_0x34[12] =
+{
+    0x1e,
+    0x1e,
+    0x36,
+    0x36,
+    0x66,
+    0x66,
+    0xc6,
+    0xff,
+    0xff,
+    0x06,
+    0x06,
+    0x06
 };
 static const CharacterImage pin_font_0x34 = { image_data_pin_font_0x34, 8, 12};
 
-static const uint8_t image_data_pin_font_0x35[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x35[12] =
+{
+    0xff,
+    0xff,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xfc,
+    0x7e,
+    0x03,
+    0x03,
+    0x03,
+    0xfe,
+    0x7c
 };
 static const CharacterImage pin_font_0x35 = { image_data_pin_font_0x35, 8, 12};
 
-static const uint8_t image_data_pin_font_0x36[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x36[12] =
+{
+    0x3c,
+    0x7e,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xfc,
+    0xfe,
+    0xc3,
+    0xc3,
+    0xc3,
+    0x7e,
+    0x3c
 };
 static const CharacterImage pin_font_0x36 = { image_data_pin_font_0x36, 8, 12};
 
-static const uint8_t image_data_pin_font_0x37[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x37[12] =
+{
+    0xff,
+    0xff,
+    0x03,
+    0x03,
+    0x06,
+    0x06,
+    0x0c,
+    0x0c,
+    0x18,
+    0x18,
+    0x30,
+    0x30
 };
 static const CharacterImage pin_font_0x37 = { image_data_pin_font_0x37, 8, 12};
 
-static const uint8_t image_data_pin_font_0x38[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x38[12] =
+{
+    0x3c,
+    0x7e,
+    0xc3,
+    0xc3,
+    0xc3,
+    0x7e,
+    0x7e,
+    0xc3,
+    0xc3,
+    0xc3,
+    0x7e,
+    0x3c
 };
 static const CharacterImage pin_font_0x38 = { image_data_pin_font_0x38, 8, 12};
 
-static const uint8_t image_data_pin_font_0x39[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint8_t image_data_pin_font_0x39[12] =
+{
+    0x3c,
+    0x7e,
+    0xc3,
+    0xc3,
+    0xc3,
+    0x7f,
+    0x3f,
+    0x03,
+    0x03,
+    0x03,
+    0x7e,
+    0x3c
 };
 static const CharacterImage pin_font_0x39 = { image_data_pin_font_0x39, 8, 12};
 
@@ -212,1432 +212,1432 @@ static const Character pin_font_array[] =
 
 };
 
-static const Font pin_font = { 10, 14, pin_font_array };
+static const Font pin_font = { 9, 14, pin_font_array };
 
 /* --- Title Font ---------------------------------------------------------- */
 
-static const uint8_t image_data_title_font_0x20[50] =
+static const uint8_t image_data_title_font_0x20[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x20 = { image_data_title_font_0x20, 5, 10};
 
-static const uint8_t image_data_title_font_0x21[30] =
+static const uint8_t image_data_title_font_0x21[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x21 = { image_data_title_font_0x21, 3, 10};
 
-static const uint8_t image_data_title_font_0x22[50] =
+static const uint8_t image_data_title_font_0x22[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0xf0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x22 = { image_data_title_font_0x22, 5, 10};
 
-static const uint8_t image_data_title_font_0x23[80] =
+static const uint8_t image_data_title_font_0x23[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x6c,
+    0xfe,
+    0x6c,
+    0x6c,
+    0xfe,
+    0x6c,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x23 = { image_data_title_font_0x23, 8, 10};
 
-static const uint8_t image_data_title_font_0x24[70] =
+static const uint8_t image_data_title_font_0x24[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x30,
+    0x7c,
+    0xf0,
+    0xf0,
+    0x78,
+    0x3c,
+    0x3c,
+    0xf8,
+    0x30,
+    0x00
 };
 static const CharacterImage title_font_0x24 = { image_data_title_font_0x24, 7, 10};
 
-static const uint8_t image_data_title_font_0x25[90] =
+static const uint8_t image_data_title_font_0x25[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0x63, 0x00,
+    0xf6, 0x00,
+    0x6c, 0x00,
+    0x18, 0x00,
+    0x36, 0x00,
+    0x6f, 0x00,
+    0xc6, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x25 = { image_data_title_font_0x25, 9, 10};
 
-static const uint8_t image_data_title_font_0x26[80] =
+static const uint8_t image_data_title_font_0x26[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0xd8,
+    0xd8,
+    0x70,
+    0xde,
+    0xcc,
+    0x7e,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x26 = { image_data_title_font_0x26, 8, 10};
 
-static const uint8_t image_data_title_font_0x27[30] =
+static const uint8_t image_data_title_font_0x27[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x27 = { image_data_title_font_0x27, 3, 10};
 
-static const uint8_t image_data_title_font_0x28[40] =
+static const uint8_t image_data_title_font_0x28[10] =
 {
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x60,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x60,
+    0x00
 };
 static const CharacterImage title_font_0x28 = { image_data_title_font_0x28, 4, 10};
 
-static const uint8_t image_data_title_font_0x29[40] =
+static const uint8_t image_data_title_font_0x29[10] =
 {
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0xc0,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0xc0,
+    0x00
 };
 static const CharacterImage title_font_0x29 = { image_data_title_font_0x29, 4, 10};
 
-static const uint8_t image_data_title_font_0x2a[70] =
+static const uint8_t image_data_title_font_0x2a[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x30,
+    0xfc,
+    0x78,
+    0xfc,
+    0x30,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x2a = { image_data_title_font_0x2a, 7, 10};
 
-static const uint8_t image_data_title_font_0x2b[70] =
+static const uint8_t image_data_title_font_0x2b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x30,
+    0x30,
+    0xfc,
+    0x30,
+    0x30,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x2b = { image_data_title_font_0x2b, 7, 10};
 
-static const uint8_t image_data_title_font_0x2c[40] =
+static const uint8_t image_data_title_font_0x2c[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xe0,
+    0xe0,
+    0x60,
+    0xc0
 };
 static const CharacterImage title_font_0x2c = { image_data_title_font_0x2c, 4, 10};
 
-static const uint8_t image_data_title_font_0x2d[70] =
+static const uint8_t image_data_title_font_0x2d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x2d = { image_data_title_font_0x2d, 7, 10};
 
-static const uint8_t image_data_title_font_0x2e[40] =
+static const uint8_t image_data_title_font_0x2e[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xe0,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x2e = { image_data_title_font_0x2e, 4, 10};
 
-static const uint8_t image_data_title_font_0x2f[90] =
+static const uint8_t image_data_title_font_0x2f[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0x03, 0x00,
+    0x06, 0x00,
+    0x0c, 0x00,
+    0x18, 0x00,
+    0x30, 0x00,
+    0x60, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x2f = { image_data_title_font_0x2f, 9, 10};
 
-static const uint8_t image_data_title_font_0x30[70] =
+static const uint8_t image_data_title_font_0x30[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xdc,
+    0xfc,
+    0xec,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x30 = { image_data_title_font_0x30, 7, 10};
 
-static const uint8_t image_data_title_font_0x31[40] =
+static const uint8_t image_data_title_font_0x31[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xe0,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x31 = { image_data_title_font_0x31, 4, 10};
 
-static const uint8_t image_data_title_font_0x32[70] =
+static const uint8_t image_data_title_font_0x32[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x0c,
+    0x0c,
+    0x78,
+    0xc0,
+    0xc0,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x32 = { image_data_title_font_0x32, 7, 10};
 
-static const uint8_t image_data_title_font_0x33[70] =
+static const uint8_t image_data_title_font_0x33[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x0c,
+    0x0c,
+    0x78,
+    0x0c,
+    0x0c,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x33 = { image_data_title_font_0x33, 7, 10};
 
-static const uint8_t image_data_title_font_0x34[70] =
+static const uint8_t image_data_title_font_0x34[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x18,
+    0x38,
+    0x78,
+    0xd8,
+    0xfc,
+    0x18,
+    0x18,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x34 = { image_data_title_font_0x34, 7, 10};
 
-static const uint8_t image_data_title_font_0x35[70] =
+static const uint8_t image_data_title_font_0x35[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0xc0,
+    0xc0,
+    0xf8,
+    0x0c,
+    0x0c,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x35 = { image_data_title_font_0x35, 7, 10};
 
-static const uint8_t image_data_title_font_0x36[70] =
+static const uint8_t image_data_title_font_0x36[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xc0,
+    0xc0,
+    0xf8,
+    0xcc,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x36 = { image_data_title_font_0x36, 7, 10};
 
-static const uint8_t image_data_title_font_0x37[70] =
+static const uint8_t image_data_title_font_0x37[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0x0c,
+    0x18,
+    0x18,
+    0x30,
+    0x30,
+    0x60,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x37 = { image_data_title_font_0x37, 7, 10};
 
-static const uint8_t image_data_title_font_0x38[70] =
+static const uint8_t image_data_title_font_0x38[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0x78,
+    0xcc,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x38 = { image_data_title_font_0x38, 7, 10};
 
-static const uint8_t image_data_title_font_0x39[70] =
+static const uint8_t image_data_title_font_0x39[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x0c,
+    0x0c,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x39 = { image_data_title_font_0x39, 7, 10};
 
-static const uint8_t image_data_title_font_0x3a[40] =
+static const uint8_t image_data_title_font_0x3a[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xe0,
+    0xe0,
+    0x00,
+    0xe0,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x3a = { image_data_title_font_0x3a, 4, 10};
 
-static const uint8_t image_data_title_font_0x3b[40] =
+static const uint8_t image_data_title_font_0x3b[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xe0,
+    0xe0,
+    0x00,
+    0xe0,
+    0xe0,
+    0x60,
+    0xc0
 };
 static const CharacterImage title_font_0x3b = { image_data_title_font_0x3b, 4, 10};
 
-static const uint8_t image_data_title_font_0x3c[60] =
+static const uint8_t image_data_title_font_0x3c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x18,
+    0x30,
+    0x60,
+    0xc0,
+    0x60,
+    0x30,
+    0x18,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x3c = { image_data_title_font_0x3c, 6, 10};
 
-static const uint8_t image_data_title_font_0x3d[70] =
+static const uint8_t image_data_title_font_0x3d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x00,
+    0xfc,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x3d = { image_data_title_font_0x3d, 7, 10};
 
-static const uint8_t image_data_title_font_0x3e[60] =
+static const uint8_t image_data_title_font_0x3e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0x60,
+    0x30,
+    0x18,
+    0x30,
+    0x60,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x3e = { image_data_title_font_0x3e, 6, 10};
 
-static const uint8_t image_data_title_font_0x3f[70] =
+static const uint8_t image_data_title_font_0x3f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0x0c,
+    0x18,
+    0x30,
+    0x00,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x3f = { image_data_title_font_0x3f, 7, 10};
 
-static const uint8_t image_data_title_font_0x40[90] =
+static const uint8_t image_data_title_font_0x40[20] =
 {
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x3e, 0x00,
+    0x63, 0x00,
+    0xdd, 0x80,
+    0xc7, 0x80,
+    0xdf, 0x80,
+    0xf7, 0x80,
+    0xdf, 0x00,
+    0x60, 0x00,
+    0x3e, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x40 = { image_data_title_font_0x40, 9, 10};
 
-static const uint8_t image_data_title_font_0x41[70] =
+static const uint8_t image_data_title_font_0x41[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0xfc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x41 = { image_data_title_font_0x41, 7, 10};
 
-static const uint8_t image_data_title_font_0x42[70] =
+static const uint8_t image_data_title_font_0x42[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x42 = { image_data_title_font_0x42, 7, 10};
 
-static const uint8_t image_data_title_font_0x43[70] =
+static const uint8_t image_data_title_font_0x43[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x43 = { image_data_title_font_0x43, 7, 10};
 
-static const uint8_t image_data_title_font_0x44[70] =
+static const uint8_t image_data_title_font_0x44[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x44 = { image_data_title_font_0x44, 7, 10};
 
-static const uint8_t image_data_title_font_0x45[70] =
+static const uint8_t image_data_title_font_0x45[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0xc0,
+    0xc0,
+    0xf8,
+    0xc0,
+    0xc0,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x45 = { image_data_title_font_0x45, 7, 10};
 
-static const uint8_t image_data_title_font_0x46[70] =
+static const uint8_t image_data_title_font_0x46[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0xc0,
+    0xc0,
+    0xf8,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x46 = { image_data_title_font_0x46, 7, 10};
 
-static const uint8_t image_data_title_font_0x47[70] =
+static const uint8_t image_data_title_font_0x47[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xc0,
+    0xdc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x47 = { image_data_title_font_0x47, 7, 10};
 
-static const uint8_t image_data_title_font_0x48[70] =
+static const uint8_t image_data_title_font_0x48[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xfc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x48 = { image_data_title_font_0x48, 7, 10};
 
-static const uint8_t image_data_title_font_0x49[50] =
+static const uint8_t image_data_title_font_0x49[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x49 = { image_data_title_font_0x49, 5, 10};
 
-static const uint8_t image_data_title_font_0x4a[70] =
+static const uint8_t image_data_title_font_0x4a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x0c,
+    0x0c,
+    0x0c,
+    0x0c,
+    0x0c,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x4a = { image_data_title_font_0x4a, 7, 10};
 
-static const uint8_t image_data_title_font_0x4b[70] =
+static const uint8_t image_data_title_font_0x4b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xd8,
+    0xf0,
+    0xe0,
+    0xf0,
+    0xd8,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x4b = { image_data_title_font_0x4b, 7, 10};
 
-static const uint8_t image_data_title_font_0x4c[70] =
+static const uint8_t image_data_title_font_0x4c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x4c = { image_data_title_font_0x4c, 7, 10};
 
-static const uint8_t image_data_title_font_0x4d[90] =
+static const uint8_t image_data_title_font_0x4d[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0xc3, 0x00,
+    0xe7, 0x00,
+    0xff, 0x00,
+    0xdb, 0x00,
+    0xc3, 0x00,
+    0xc3, 0x00,
+    0xc3, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x4d = { image_data_title_font_0x4d, 9, 10};
 
-static const uint8_t image_data_title_font_0x4e[70] =
+static const uint8_t image_data_title_font_0x4e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0xec,
+    0xfc,
+    0xdc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x4e = { image_data_title_font_0x4e, 7, 10};
 
-static const uint8_t image_data_title_font_0x4f[70] =
+static const uint8_t image_data_title_font_0x4f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x4f = { image_data_title_font_0x4f, 7, 10};
 
-static const uint8_t image_data_title_font_0x50[70] =
+static const uint8_t image_data_title_font_0x50[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xf8,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x50 = { image_data_title_font_0x50, 7, 10};
 
-static const uint8_t image_data_title_font_0x51[70] =
+static const uint8_t image_data_title_font_0x51[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x0c,
+    0x00
 };
 static const CharacterImage title_font_0x51 = { image_data_title_font_0x51, 7, 10};
 
-static const uint8_t image_data_title_font_0x52[70] =
+static const uint8_t image_data_title_font_0x52[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xf8,
+    0xd8,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x52 = { image_data_title_font_0x52, 7, 10};
 
-static const uint8_t image_data_title_font_0x53[70] =
+static const uint8_t image_data_title_font_0x53[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x78,
+    0xcc,
+    0xc0,
+    0x78,
+    0x0c,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x53 = { image_data_title_font_0x53, 7, 10};
 
-static const uint8_t image_data_title_font_0x54[70] =
+static const uint8_t image_data_title_font_0x54[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x54 = { image_data_title_font_0x54, 7, 10};
 
-static const uint8_t image_data_title_font_0x55[70] =
+static const uint8_t image_data_title_font_0x55[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x55 = { image_data_title_font_0x55, 7, 10};
 
-static const uint8_t image_data_title_font_0x56[70] =
+static const uint8_t image_data_title_font_0x56[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x78,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x56 = { image_data_title_font_0x56, 7, 10};
 
-static const uint8_t image_data_title_font_0x57[90] =
+static const uint8_t image_data_title_font_0x57[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0x7e, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x57 = { image_data_title_font_0x57, 9, 10};
 
-static const uint8_t image_data_title_font_0x58[70] =
+static const uint8_t image_data_title_font_0x58[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0x78,
+    0x30,
+    0x78,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x58 = { image_data_title_font_0x58, 7, 10};
 
-static const uint8_t image_data_title_font_0x59[70] =
+static const uint8_t image_data_title_font_0x59[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x30,
+    0x30,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x59 = { image_data_title_font_0x59, 7, 10};
 
-static const uint8_t image_data_title_font_0x5a[70] =
+static const uint8_t image_data_title_font_0x5a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xfc,
+    0x0c,
+    0x18,
+    0x30,
+    0x60,
+    0xc0,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x5a = { image_data_title_font_0x5a, 7, 10};
 
-static const uint8_t image_data_title_font_0x5b[50] =
+static const uint8_t image_data_title_font_0x5b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x5b = { image_data_title_font_0x5b, 5, 10};
 
-static const uint8_t image_data_title_font_0x5c[90] =
+static const uint8_t image_data_title_font_0x5c[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0xc0, 0x00,
+    0x60, 0x00,
+    0x30, 0x00,
+    0x18, 0x00,
+    0x0c, 0x00,
+    0x06, 0x00,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x5c = { image_data_title_font_0x5c, 9, 10};
 
-static const uint8_t image_data_title_font_0x5d[50] =
+static const uint8_t image_data_title_font_0x5d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x5d = { image_data_title_font_0x5d, 5, 10};
 
-static const uint8_t image_data_title_font_0x5e[50] =
+static const uint8_t image_data_title_font_0x5e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x60,
+    0xf0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x5e = { image_data_title_font_0x5e, 5, 10};
 
-static const uint8_t image_data_title_font_0x5f[70] =
+static const uint8_t image_data_title_font_0x5f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x5f = { image_data_title_font_0x5f, 7, 10};
 
-static const uint8_t image_data_title_font_0x60[40] =
+static const uint8_t image_data_title_font_0x60[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x60 = { image_data_title_font_0x60, 4, 10};
 
-static const uint8_t image_data_title_font_0x61[70] =
+static const uint8_t image_data_title_font_0x61[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x0c,
+    0x7c,
+    0xcc,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x61 = { image_data_title_font_0x61, 7, 10};
 
-static const uint8_t image_data_title_font_0x62[70] =
+static const uint8_t image_data_title_font_0x62[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x62 = { image_data_title_font_0x62, 7, 10};
 
-static const uint8_t image_data_title_font_0x63[70] =
+static const uint8_t image_data_title_font_0x63[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x63 = { image_data_title_font_0x63, 7, 10};
 
-static const uint8_t image_data_title_font_0x64[70] =
+static const uint8_t image_data_title_font_0x64[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x0c,
+    0x0c,
+    0x7c,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x64 = { image_data_title_font_0x64, 7, 10};
 
-static const uint8_t image_data_title_font_0x65[70] =
+static const uint8_t image_data_title_font_0x65[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0xcc,
+    0xfc,
+    0xc0,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x65 = { image_data_title_font_0x65, 7, 10};
 
-static const uint8_t image_data_title_font_0x66[60] =
+static const uint8_t image_data_title_font_0x66[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x38,
+    0x60,
+    0xf8,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x66 = { image_data_title_font_0x66, 6, 10};
 
-static const uint8_t image_data_title_font_0x67[70] =
+static const uint8_t image_data_title_font_0x67[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x0c,
+    0x78
 };
 static const CharacterImage title_font_0x67 = { image_data_title_font_0x67, 7, 10};
 
-static const uint8_t image_data_title_font_0x68[70] =
+static const uint8_t image_data_title_font_0x68[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x68 = { image_data_title_font_0x68, 7, 10};
 
-static const uint8_t image_data_title_font_0x69[30] =
+static const uint8_t image_data_title_font_0x69[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x69 = { image_data_title_font_0x69, 3, 10};
 
-static const uint8_t image_data_title_font_0x6a[40] =
+static const uint8_t image_data_title_font_0x6a[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x60,
+    0x00,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0xc0
 };
 static const CharacterImage title_font_0x6a = { image_data_title_font_0x6a, 4, 10};
 
-static const uint8_t image_data_title_font_0x6b[60] =
+static const uint8_t image_data_title_font_0x6b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xd8,
+    0xf0,
+    0xe0,
+    0xf0,
+    0xd8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x6b = { image_data_title_font_0x6b, 6, 10};
 
-static const uint8_t image_data_title_font_0x6c[30] =
+static const uint8_t image_data_title_font_0x6c[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x6c = { image_data_title_font_0x6c, 3, 10};
 
-static const uint8_t image_data_title_font_0x6d[90] =
+static const uint8_t image_data_title_font_0x6d[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfe, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x6d = { image_data_title_font_0x6d, 9, 10};
 
-static const uint8_t image_data_title_font_0x6e[70] =
+static const uint8_t image_data_title_font_0x6e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x6e = { image_data_title_font_0x6e, 7, 10};
 
-static const uint8_t image_data_title_font_0x6f[70] =
+static const uint8_t image_data_title_font_0x6f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x6f = { image_data_title_font_0x6f, 7, 10};
 
-static const uint8_t image_data_title_font_0x70[70] =
+static const uint8_t image_data_title_font_0x70[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xf8,
+    0xc0,
+    0xc0
 };
 static const CharacterImage title_font_0x70 = { image_data_title_font_0x70, 7, 10};
 
-static const uint8_t image_data_title_font_0x71[70] =
+static const uint8_t image_data_title_font_0x71[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x0c,
+    0x0c
 };
 static const CharacterImage title_font_0x71 = { image_data_title_font_0x71, 7, 10};
 
-static const uint8_t image_data_title_font_0x72[60] =
+static const uint8_t image_data_title_font_0x72[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0xe0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x72 = { image_data_title_font_0x72, 6, 10};
 
-static const uint8_t image_data_title_font_0x73[70] =
+static const uint8_t image_data_title_font_0x73[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xc0,
+    0x78,
+    0x0c,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x73 = { image_data_title_font_0x73, 7, 10};
 
-static const uint8_t image_data_title_font_0x74[60] =
+static const uint8_t image_data_title_font_0x74[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x60,
+    0x60,
+    0xf8,
+    0x60,
+    0x60,
+    0x60,
+    0x38,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x74 = { image_data_title_font_0x74, 6, 10};
 
-static const uint8_t image_data_title_font_0x75[70] =
+static const uint8_t image_data_title_font_0x75[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x75 = { image_data_title_font_0x75, 7, 10};
 
-static const uint8_t image_data_title_font_0x76[70] =
+static const uint8_t image_data_title_font_0x76[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xcc,
+    0xcc,
+    0x78,
+    0x78,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x76 = { image_data_title_font_0x76, 7, 10};
 
-static const uint8_t image_data_title_font_0x77[90] =
+static const uint8_t image_data_title_font_0x77[20] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0xdb, 0x00,
+    0x7e, 0x00,
+    0x00, 0x00,
+    0x00, 0x00
 };
 static const CharacterImage title_font_0x77 = { image_data_title_font_0x77, 9, 10};
 
-static const uint8_t image_data_title_font_0x78[70] =
+static const uint8_t image_data_title_font_0x78[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xcc,
+    0x78,
+    0x30,
+    0x78,
+    0xcc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x78 = { image_data_title_font_0x78, 7, 10};
 
-static const uint8_t image_data_title_font_0x79[70] =
+static const uint8_t image_data_title_font_0x79[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x7c,
+    0x0c,
+    0x78
 };
 static const CharacterImage title_font_0x79 = { image_data_title_font_0x79, 7, 10};
 
-static const uint8_t image_data_title_font_0x7a[70] =
+static const uint8_t image_data_title_font_0x7a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x18,
+    0x30,
+    0x60,
+    0xfc,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x7a = { image_data_title_font_0x7a, 7, 10};
 
-static const uint8_t image_data_title_font_0x7b[60] =
+static const uint8_t image_data_title_font_0x7b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x38,
+    0x60,
+    0x60,
+    0xc0,
+    0x60,
+    0x60,
+    0x38,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x7b = { image_data_title_font_0x7b, 6, 10};
 
-static const uint8_t image_data_title_font_0x7c[30] =
+static const uint8_t image_data_title_font_0x7c[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x7c = { image_data_title_font_0x7c, 3, 10};
 
-static const uint8_t image_data_title_font_0x7d[60] =
+static const uint8_t image_data_title_font_0x7d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xe0,
+    0x30,
+    0x30,
+    0x18,
+    0x30,
+    0x30,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x7d = { image_data_title_font_0x7d, 6, 10};
 
-static const uint8_t image_data_title_font_0x7e[70] =
+static const uint8_t image_data_title_font_0x7e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x7c,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage title_font_0x7e = { image_data_title_font_0x7e, 7, 10};
 
@@ -1936,1428 +1936,1428 @@ static const Font title_font = { 95, 10, title_font_array };
 
 /* --- Body Font ----------------------------------------------------------- */
 
-static const uint8_t image_data_body_font_0x20[40] =
+static const uint8_t image_data_body_font_0x20[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x20 = { image_data_body_font_0x20, 4, 10};
 
-static const uint8_t image_data_body_font_0x21[20] =
+static const uint8_t image_data_body_font_0x21[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x21 = { image_data_body_font_0x21, 2, 10};
 
-static const uint8_t image_data_body_font_0x22[40] =
+static const uint8_t image_data_body_font_0x22[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xa0,
+    0xa0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x22 = { image_data_body_font_0x22, 4, 10};
 
-static const uint8_t image_data_body_font_0x23[70] =
+static const uint8_t image_data_body_font_0x23[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x48,
+    0xfc,
+    0x48,
+    0x48,
+    0xfc,
+    0x48,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x23 = { image_data_body_font_0x23, 7, 10};
 
-static const uint8_t image_data_body_font_0x24[60] =
+static const uint8_t image_data_body_font_0x24[10] =
 {
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x20,
+    0x78,
+    0xa0,
+    0xa0,
+    0x70,
+    0x28,
+    0x28,
+    0xf0,
+    0x20,
+    0x00
 };
 static const CharacterImage body_font_0x24 = { image_data_body_font_0x24, 6, 10};
 
-static const uint8_t image_data_body_font_0x25[80] =
+static const uint8_t image_data_body_font_0x25[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x42,
+    0xa4,
+    0x48,
+    0x10,
+    0x24,
+    0x4a,
+    0x84,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x25 = { image_data_body_font_0x25, 8, 10};
 
-static const uint8_t image_data_body_font_0x26[70] =
+static const uint8_t image_data_body_font_0x26[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x60,
+    0x90,
+    0x90,
+    0x60,
+    0x94,
+    0x88,
+    0x74,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x26 = { image_data_body_font_0x26, 7, 10};
 
-static const uint8_t image_data_body_font_0x27[20] =
+static const uint8_t image_data_body_font_0x27[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x27 = { image_data_body_font_0x27, 2, 10};
 
-static const uint8_t image_data_body_font_0x28[30] =
+static const uint8_t image_data_body_font_0x28[10] =
 {
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff
+    0x40,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x40,
+    0x00
 };
 static const CharacterImage body_font_0x28 = { image_data_body_font_0x28, 3, 10};
 
-static const uint8_t image_data_body_font_0x29[30] =
+static const uint8_t image_data_body_font_0x29[10] =
 {
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x80,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x80,
+    0x00
 };
 static const CharacterImage body_font_0x29 = { image_data_body_font_0x29, 3, 10};
 
-static const uint8_t image_data_body_font_0x2a[60] =
+static const uint8_t image_data_body_font_0x2a[10] =
 {
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x20,
+    0xa8,
+    0x70,
+    0xa8,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x2a = { image_data_body_font_0x2a, 6, 10};
 
-static const uint8_t image_data_body_font_0x2b[60] =
+static const uint8_t image_data_body_font_0x2b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x20,
+    0x20,
+    0xf8,
+    0x20,
+    0x20,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x2b = { image_data_body_font_0x2b, 6, 10};
 
-static const uint8_t image_data_body_font_0x2c[30] =
+static const uint8_t image_data_body_font_0x2c[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x40,
+    0x80
 };
 static const CharacterImage body_font_0x2c = { image_data_body_font_0x2c, 3, 10};
 
-static const uint8_t image_data_body_font_0x2d[60] =
+static const uint8_t image_data_body_font_0x2d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x2d = { image_data_body_font_0x2d, 6, 10};
 
-static const uint8_t image_data_body_font_0x2e[30] =
+static const uint8_t image_data_body_font_0x2e[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x2e = { image_data_body_font_0x2e, 3, 10};
 
-static const uint8_t image_data_body_font_0x2f[80] =
+static const uint8_t image_data_body_font_0x2f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x02,
+    0x04,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x2f = { image_data_body_font_0x2f, 8, 10};
 
-static const uint8_t image_data_body_font_0x30[60] =
+static const uint8_t image_data_body_font_0x30[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x98,
+    0xa8,
+    0xc8,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x30 = { image_data_body_font_0x30, 6, 10};
 
-static const uint8_t image_data_body_font_0x31[30] =
+static const uint8_t image_data_body_font_0x31[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x31 = { image_data_body_font_0x31, 3, 10};
 
-static const uint8_t image_data_body_font_0x32[60] =
+static const uint8_t image_data_body_font_0x32[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x08,
+    0x08,
+    0x70,
+    0x80,
+    0x80,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x32 = { image_data_body_font_0x32, 6, 10};
 
-static const uint8_t image_data_body_font_0x33[60] =
+static const uint8_t image_data_body_font_0x33[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x08,
+    0x08,
+    0x70,
+    0x08,
+    0x08,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x33 = { image_data_body_font_0x33, 6, 10};
 
-static const uint8_t image_data_body_font_0x34[60] =
+static const uint8_t image_data_body_font_0x34[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x10,
+    0x30,
+    0x50,
+    0x90,
+    0xf8,
+    0x10,
+    0x10,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x34 = { image_data_body_font_0x34, 6, 10};
 
-static const uint8_t image_data_body_font_0x35[60] =
+static const uint8_t image_data_body_font_0x35[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x80,
+    0x80,
+    0xf0,
+    0x08,
+    0x08,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x35 = { image_data_body_font_0x35, 6, 10};
 
-static const uint8_t image_data_body_font_0x36[60] =
+static const uint8_t image_data_body_font_0x36[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x80,
+    0x80,
+    0xf0,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x36 = { image_data_body_font_0x36, 6, 10};
 
-static const uint8_t image_data_body_font_0x37[60] =
+static const uint8_t image_data_body_font_0x37[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x08,
+    0x10,
+    0x10,
+    0x20,
+    0x20,
+    0x40,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x37 = { image_data_body_font_0x37, 6, 10};
 
-static const uint8_t image_data_body_font_0x38[60] =
+static const uint8_t image_data_body_font_0x38[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0x70,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x38 = { image_data_body_font_0x38, 6, 10};
 
-static const uint8_t image_data_body_font_0x39[60] =
+static const uint8_t image_data_body_font_0x39[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0x78,
+    0x08,
+    0x08,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x39 = { image_data_body_font_0x39, 6, 10};
 
-static const uint8_t image_data_body_font_0x3a[30] =
+static const uint8_t image_data_body_font_0x3a[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x3a = { image_data_body_font_0x3a, 3, 10};
 
-static const uint8_t image_data_body_font_0x3b[30] =
+static const uint8_t image_data_body_font_0x3b[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0xc0,
+    0xc0,
+    0x40,
+    0x80
 };
 static const CharacterImage body_font_0x3b = { image_data_body_font_0x3b, 3, 10};
 
-static const uint8_t image_data_body_font_0x3c[50] =
+static const uint8_t image_data_body_font_0x3c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0x40,
+    0x20,
+    0x10,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x3c = { image_data_body_font_0x3c, 5, 10};
 
-static const uint8_t image_data_body_font_0x3d[60] =
+static const uint8_t image_data_body_font_0x3d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0x00,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x3d = { image_data_body_font_0x3d, 6, 10};
 
-static const uint8_t image_data_body_font_0x3e[50] =
+static const uint8_t image_data_body_font_0x3e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x40,
+    0x20,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x3e = { image_data_body_font_0x3e, 5, 10};
 
-static const uint8_t image_data_body_font_0x3f[60] =
+static const uint8_t image_data_body_font_0x3f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x08,
+    0x10,
+    0x20,
+    0x00,
+    0x20,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x3f = { image_data_body_font_0x3f, 6, 10};
 
-static const uint8_t image_data_body_font_0x40[80] =
+static const uint8_t image_data_body_font_0x40[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x3c,
+    0x42,
+    0x99,
+    0x85,
+    0x9d,
+    0xa5,
+    0x9e,
+    0x40,
+    0x3c,
+    0x00
 };
 static const CharacterImage body_font_0x40 = { image_data_body_font_0x40, 8, 10};
 
-static const uint8_t image_data_body_font_0x41[60] =
+static const uint8_t image_data_body_font_0x41[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0xf8,
+    0x88,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x41 = { image_data_body_font_0x41, 6, 10};
 
-static const uint8_t image_data_body_font_0x42[60] =
+static const uint8_t image_data_body_font_0x42[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0xf0,
+    0x88,
+    0x88,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x42 = { image_data_body_font_0x42, 6, 10};
 
-static const uint8_t image_data_body_font_0x43[60] =
+static const uint8_t image_data_body_font_0x43[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x80,
+    0x80,
+    0x80,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x43 = { image_data_body_font_0x43, 6, 10};
 
-static const uint8_t image_data_body_font_0x44[60] =
+static const uint8_t image_data_body_font_0x44[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x44 = { image_data_body_font_0x44, 6, 10};
 
-static const uint8_t image_data_body_font_0x45[60] =
+static const uint8_t image_data_body_font_0x45[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x80,
+    0x80,
+    0xf0,
+    0x80,
+    0x80,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x45 = { image_data_body_font_0x45, 6, 10};
 
-static const uint8_t image_data_body_font_0x46[60] =
+static const uint8_t image_data_body_font_0x46[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x80,
+    0x80,
+    0xf0,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x46 = { image_data_body_font_0x46, 6, 10};
 
-static const uint8_t image_data_body_font_0x47[60] =
+static const uint8_t image_data_body_font_0x47[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x80,
+    0xb8,
+    0x88,
+    0x88,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x47 = { image_data_body_font_0x47, 6, 10};
 
-static const uint8_t image_data_body_font_0x48[60] =
+static const uint8_t image_data_body_font_0x48[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0xf8,
+    0x88,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x48 = { image_data_body_font_0x48, 6, 10};
 
-static const uint8_t image_data_body_font_0x49[40] =
+static const uint8_t image_data_body_font_0x49[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xe0,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x49 = { image_data_body_font_0x49, 4, 10};
 
-static const uint8_t image_data_body_font_0x4a[60] =
+static const uint8_t image_data_body_font_0x4a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x08,
+    0x08,
+    0x08,
+    0x08,
+    0x08,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4a = { image_data_body_font_0x4a, 6, 10};
 
-static const uint8_t image_data_body_font_0x4b[60] =
+static const uint8_t image_data_body_font_0x4b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x90,
+    0xa0,
+    0xc0,
+    0xa0,
+    0x90,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4b = { image_data_body_font_0x4b, 6, 10};
 
-static const uint8_t image_data_body_font_0x4c[60] =
+static const uint8_t image_data_body_font_0x4c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4c = { image_data_body_font_0x4c, 6, 10};
 
-static const uint8_t image_data_body_font_0x4d[80] =
+static const uint8_t image_data_body_font_0x4d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x82,
+    0xc6,
+    0xaa,
+    0x92,
+    0x82,
+    0x82,
+    0x82,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4d = { image_data_body_font_0x4d, 8, 10};
 
-static const uint8_t image_data_body_font_0x4e[60] =
+static const uint8_t image_data_body_font_0x4e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0xc8,
+    0xa8,
+    0x98,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4e = { image_data_body_font_0x4e, 6, 10};
 
-static const uint8_t image_data_body_font_0x4f[60] =
+static const uint8_t image_data_body_font_0x4f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x4f = { image_data_body_font_0x4f, 6, 10};
 
-static const uint8_t image_data_body_font_0x50[60] =
+static const uint8_t image_data_body_font_0x50[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0xf0,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x50 = { image_data_body_font_0x50, 6, 10};
 
-static const uint8_t image_data_body_font_0x51[60] =
+static const uint8_t image_data_body_font_0x51[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x70,
+    0x08,
+    0x00
 };
 static const CharacterImage body_font_0x51 = { image_data_body_font_0x51, 6, 10};
 
-static const uint8_t image_data_body_font_0x52[60] =
+static const uint8_t image_data_body_font_0x52[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0xf0,
+    0x90,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x52 = { image_data_body_font_0x52, 6, 10};
 
-static const uint8_t image_data_body_font_0x53[60] =
+static const uint8_t image_data_body_font_0x53[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x70,
+    0x88,
+    0x80,
+    0x70,
+    0x08,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x53 = { image_data_body_font_0x53, 6, 10};
 
-static const uint8_t image_data_body_font_0x54[60] =
+static const uint8_t image_data_body_font_0x54[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x54 = { image_data_body_font_0x54, 6, 10};
 
-static const uint8_t image_data_body_font_0x55[60] =
+static const uint8_t image_data_body_font_0x55[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x55 = { image_data_body_font_0x55, 6, 10};
 
-static const uint8_t image_data_body_font_0x56[60] =
+static const uint8_t image_data_body_font_0x56[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x50,
+    0x50,
+    0x20,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x56 = { image_data_body_font_0x56, 6, 10};
 
-static const uint8_t image_data_body_font_0x57[80] =
+static const uint8_t image_data_body_font_0x57[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x92,
+    0x92,
+    0x92,
+    0x92,
+    0x92,
+    0x92,
+    0x6c,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x57 = { image_data_body_font_0x57, 8, 10};
 
-static const uint8_t image_data_body_font_0x58[60] =
+static const uint8_t image_data_body_font_0x58[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0x50,
+    0x20,
+    0x50,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x58 = { image_data_body_font_0x58, 6, 10};
 
-static const uint8_t image_data_body_font_0x59[60] =
+static const uint8_t image_data_body_font_0x59[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0x50,
+    0x20,
+    0x20,
+    0x20,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x59 = { image_data_body_font_0x59, 6, 10};
 
-static const uint8_t image_data_body_font_0x5a[60] =
+static const uint8_t image_data_body_font_0x5a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xf8,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5a = { image_data_body_font_0x5a, 6, 10};
 
-static const uint8_t image_data_body_font_0x5b[40] =
+static const uint8_t image_data_body_font_0x5b[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xe0,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5b = { image_data_body_font_0x5b, 4, 10};
 
-static const uint8_t image_data_body_font_0x5c[80] =
+static const uint8_t image_data_body_font_0x5c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x40,
+    0x20,
+    0x10,
+    0x08,
+    0x04,
+    0x02,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5c = { image_data_body_font_0x5c, 8, 10};
 
-static const uint8_t image_data_body_font_0x5d[40] =
+static const uint8_t image_data_body_font_0x5d[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xe0,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xe0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5d = { image_data_body_font_0x5d, 4, 10};
 
-static const uint8_t image_data_body_font_0x5e[40] =
+static const uint8_t image_data_body_font_0x5e[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x40,
+    0xa0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5e = { image_data_body_font_0x5e, 4, 10};
 
-static const uint8_t image_data_body_font_0x5f[60] =
+static const uint8_t image_data_body_font_0x5f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x5f = { image_data_body_font_0x5f, 6, 10};
 
-static const uint8_t image_data_body_font_0x60[30] =
+static const uint8_t image_data_body_font_0x60[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x60 = { image_data_body_font_0x60, 3, 10};
 
-static const uint8_t image_data_body_font_0x61[60] =
+static const uint8_t image_data_body_font_0x61[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x70,
+    0x08,
+    0x78,
+    0x88,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x61 = { image_data_body_font_0x61, 6, 10};
 
-static const uint8_t image_data_body_font_0x62[60] =
+static const uint8_t image_data_body_font_0x62[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x62 = { image_data_body_font_0x62, 6, 10};
 
-static const uint8_t image_data_body_font_0x63[60] =
+static const uint8_t image_data_body_font_0x63[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x80,
+    0x80,
+    0x80,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x63 = { image_data_body_font_0x63, 6, 10};
 
-static const uint8_t image_data_body_font_0x64[60] =
+static const uint8_t image_data_body_font_0x64[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x08,
+    0x08,
+    0x78,
+    0x88,
+    0x88,
+    0x88,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x64 = { image_data_body_font_0x64, 6, 10};
 
-static const uint8_t image_data_body_font_0x65[60] =
+static const uint8_t image_data_body_font_0x65[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x70,
+    0x88,
+    0xf8,
+    0x80,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x65 = { image_data_body_font_0x65, 6, 10};
 
-static const uint8_t image_data_body_font_0x66[50] =
+static const uint8_t image_data_body_font_0x66[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x30,
+    0x40,
+    0xf0,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x66 = { image_data_body_font_0x66, 5, 10};
 
-static const uint8_t image_data_body_font_0x67[60] =
+static const uint8_t image_data_body_font_0x67[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x88,
+    0x88,
+    0x88,
+    0x78,
+    0x08,
+    0x70
 };
 static const CharacterImage body_font_0x67 = { image_data_body_font_0x67, 6, 10};
 
-static const uint8_t image_data_body_font_0x68[60] =
+static const uint8_t image_data_body_font_0x68[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x68 = { image_data_body_font_0x68, 6, 10};
 
-static const uint8_t image_data_body_font_0x69[20] =
+static const uint8_t image_data_body_font_0x69[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x00,
+    0x80,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x69 = { image_data_body_font_0x69, 2, 10};
 
-static const uint8_t image_data_body_font_0x6a[30] =
+static const uint8_t image_data_body_font_0x6a[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x00,
+    0x40,
+    0x00,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x80
 };
 static const CharacterImage body_font_0x6a = { image_data_body_font_0x6a, 3, 10};
 
-static const uint8_t image_data_body_font_0x6b[50] =
+static const uint8_t image_data_body_font_0x6b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x90,
+    0xa0,
+    0xc0,
+    0xa0,
+    0x90,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x6b = { image_data_body_font_0x6b, 5, 10};
 
-static const uint8_t image_data_body_font_0x6c[20] =
+static const uint8_t image_data_body_font_0x6c[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x6c = { image_data_body_font_0x6c, 2, 10};
 
-static const uint8_t image_data_body_font_0x6d[80] =
+static const uint8_t image_data_body_font_0x6d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x92,
+    0x92,
+    0x92,
+    0x92,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x6d = { image_data_body_font_0x6d, 8, 10};
 
-static const uint8_t image_data_body_font_0x6e[60] =
+static const uint8_t image_data_body_font_0x6e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x6e = { image_data_body_font_0x6e, 6, 10};
 
-static const uint8_t image_data_body_font_0x6f[60] =
+static const uint8_t image_data_body_font_0x6f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x70,
+    0x88,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x6f = { image_data_body_font_0x6f, 6, 10};
 
-static const uint8_t image_data_body_font_0x70[60] =
+static const uint8_t image_data_body_font_0x70[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf0,
+    0x88,
+    0x88,
+    0x88,
+    0xf0,
+    0x80,
+    0x80
 };
 static const CharacterImage body_font_0x70 = { image_data_body_font_0x70, 6, 10};
 
-static const uint8_t image_data_body_font_0x71[60] =
+static const uint8_t image_data_body_font_0x71[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x88,
+    0x88,
+    0x88,
+    0x78,
+    0x08,
+    0x08
 };
 static const CharacterImage body_font_0x71 = { image_data_body_font_0x71, 6, 10};
 
-static const uint8_t image_data_body_font_0x72[50] =
+static const uint8_t image_data_body_font_0x72[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xb0,
+    0xc0,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x72 = { image_data_body_font_0x72, 5, 10};
 
-static const uint8_t image_data_body_font_0x73[60] =
+static const uint8_t image_data_body_font_0x73[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x80,
+    0x70,
+    0x08,
+    0xf0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x73 = { image_data_body_font_0x73, 6, 10};
 
-static const uint8_t image_data_body_font_0x74[50] =
+static const uint8_t image_data_body_font_0x74[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x40,
+    0x40,
+    0xf0,
+    0x40,
+    0x40,
+    0x40,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x74 = { image_data_body_font_0x74, 5, 10};
 
-static const uint8_t image_data_body_font_0x75[60] =
+static const uint8_t image_data_body_font_0x75[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x78,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x75 = { image_data_body_font_0x75, 6, 10};
 
-static const uint8_t image_data_body_font_0x76[60] =
+static const uint8_t image_data_body_font_0x76[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x88,
+    0x88,
+    0x50,
+    0x50,
+    0x20,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x76 = { image_data_body_font_0x76, 6, 10};
 
-static const uint8_t image_data_body_font_0x77[80] =
+static const uint8_t image_data_body_font_0x77[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x92,
+    0x92,
+    0x92,
+    0x92,
+    0x6c,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x77 = { image_data_body_font_0x77, 8, 10};
 
-static const uint8_t image_data_body_font_0x78[60] =
+static const uint8_t image_data_body_font_0x78[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x88,
+    0x50,
+    0x20,
+    0x50,
+    0x88,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x78 = { image_data_body_font_0x78, 6, 10};
 
-static const uint8_t image_data_body_font_0x79[60] =
+static const uint8_t image_data_body_font_0x79[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0x88,
+    0x88,
+    0x88,
+    0x88,
+    0x78,
+    0x08,
+    0x70
 };
 static const CharacterImage body_font_0x79 = { image_data_body_font_0x79, 6, 10};
 
-static const uint8_t image_data_body_font_0x7a[60] =
+static const uint8_t image_data_body_font_0x7a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x00,
+    0x00,
+    0xf8,
+    0x10,
+    0x20,
+    0x40,
+    0xf8,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x7a = { image_data_body_font_0x7a, 6, 10};
 
-static const uint8_t image_data_body_font_0x7b[50] =
+static const uint8_t image_data_body_font_0x7b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x30,
+    0x40,
+    0x40,
+    0x80,
+    0x40,
+    0x40,
+    0x30,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x7b = { image_data_body_font_0x7b, 5, 10};
 
-static const uint8_t image_data_body_font_0x7c[20] =
+static const uint8_t image_data_body_font_0x7c[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x7c = { image_data_body_font_0x7c, 2, 10};
 
-static const uint8_t image_data_body_font_0x7d[50] =
+static const uint8_t image_data_body_font_0x7d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0xc0,
+    0x20,
+    0x20,
+    0x10,
+    0x20,
+    0x20,
+    0xc0,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x7d = { image_data_body_font_0x7d, 5, 10};
 
-static const uint8_t image_data_body_font_0x7e[70] =
+static const uint8_t image_data_body_font_0x7e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x00,
+    0x02,
+    0x02,
+    0x04,
+    0x04,
+    0x48,
+    0x28,
+    0x10,
+    0x00,
+    0x00
 };
 static const CharacterImage body_font_0x7e = { image_data_body_font_0x7e, 7, 10};
 
@@ -3697,32 +3697,51 @@ const Font *get_body_font(void)
 }
 
 /*
- * font_get_char() - Get a character fot the provided font
+ * font_get_char_index() - Get index of a character in the provided font
  *
  * INPUT
  *     - font: pointer to font structure
  *     - c: ascii charactor
  * OUTPUT
- *     pointer to ascii charactor image
+ *     index into font characters or -1 if font does not have the character
  *
  */
-const CharacterImage *font_get_char(const Font *font, char c)
+int font_get_char_index(const Font *font, char c)
 {
-    const CharacterImage *img = NULL;
+    /* Fonts are generated with consecutive codes so try a direct lookup first */
+    int i = c - font->characters[ 0 ].code;
 
-    int i = 0;
+    if((i >= 0) && (i < font->length) && (font->characters[ i ].code == c))
+    {
+        return i;
+    }
 
-    while((i < font->length) && (img == NULL))
+    for(i = 0; i < font->length; i++)
     {
         if(font->characters[ i ].code == c)
         {
-            img = font->characters[ i ].image;
+            return i;
         }
-
-        i++;
     }
 
-    return img;
+    return -1;
+}
+
+/*
+ * font_get_char() - Get a character fot the provided font
+ *
+ * INPUT
+ *     - font: pointer to font structure
+ *     - c: ascii charactor
+ * OUTPUT
+ *     pointer to ascii charactor image
+ *
+ */
+const CharacterImage *font_get_char(const Font *font, char c)
+{
+    int i = font_get_char_index(font, c);
+
+    return (i < 0) ? NULL : font->characters[ i ].image;
 }
 
 /*
@@ -30,6 +30,7 @@
 #include <libopencm3/cm3/cortex.h>
 
 #include "keepkey_board.h"
+#include "trace.h"
 
 /* === Variables =========================================================== */
 
@@ -115,6 +116,7 @@ void board_init(void)
     keepkey_leds_init();
     keepkey_button_init();
     layout_init(display_canvas_init());
+    trace_init();
 }
 
 /* calc_crc32() - Calculate crc32 for block of memory
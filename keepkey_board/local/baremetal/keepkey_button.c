@@ -29,6 +29,7 @@
 
 #include "keepkey_button.h"
 #include "keepkey_leds.h"
+#include "timer.h"
 
 /* === Private Variables =================================================== */
 
@@ -153,6 +154,7 @@ bool keepkey_button_down(void)
 void exti9_5_isr(void)
 {
     exti_reset_request(BUTTON_EXTI);
+    post_event(EVENT_BUTTON);
 
     if(gpio_get(BUTTON_PORT, BUTTON_PIN) & BUTTON_PIN)
     {
@@ -25,6 +25,7 @@
 #include "keepkey_display.h"
 #include "pin.h"
 #include "timer.h"
+#include "trace.h"
 
 /* === Private Variables =================================================== */
 
@@ -46,7 +47,7 @@ static const Pin nRESET_PIN    = { GPIOB, GPIO5 };
 
 static const Pin BACKLIGHT_PWR_PIN = { GPIOB, GPIO0 };
 
-static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH ];
+static uint8_t canvas_buffer[ KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH / 2 ];
 static Canvas canvas;
 
 /* === Private Functions =================================================== */
@@ -249,6 +250,49 @@ static void display_write_ram(uint8_t val)
     __asm__("nop");
 }
 
+/*
+ * display_set_window() - Set display ram area written by following data
+ *
+ * INPUT
+ *     - x0: left pixel, multiple of 4
+ *     - x1: right pixel, inclusive
+ *     - y0: top row
+ *     - y1: bottom row, inclusive
+ * OUTPUT
+ *     none
+ */
+static void display_set_window(int x0, int x1, int y0, int y1)
+{
+    /* Columns are in units of 4 pixels (2 bytes at 4 bits/pixel) */
+    display_write_reg((uint8_t)0x75);
+    display_write_ram((uint8_t)(START_ROW + y0));
+    display_write_ram((uint8_t)(START_ROW + y1));
+    display_write_reg((uint8_t)0x15);
+    display_write_ram((uint8_t)(START_COL + x0 / 4));
+    display_write_ram((uint8_t)(START_COL + x1 / 4));
+}
+
+/*
+ * display_pixels() - Get canvas pixel pair shown at a display position
+ *
+ * INPUT
+ *     - x: display column, even
+ *     - y: display row
+ * OUTPUT
+ *     display ram byte for pixels x and x + 1
+ */
+static inline uint8_t display_pixels(int x, int y)
+{
+#ifdef INVERT_DISPLAY
+    /* Display is mounted rotated by 180 degrees, pixel pair order swaps too */
+    uint8_t v = canvas.buffer[(canvas.height - 1 - y) * CANVAS_STRIDE(&canvas) +
+                              (canvas.width - 2 - x) / 2];
+    return((uint8_t)((v << 4) | (v >> 4)));
+#else
+    return(canvas.buffer[y * CANVAS_STRIDE(&canvas) + x / 2]);
+#endif
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -293,32 +337,45 @@ Canvas *display_canvas(void)
  */
 void display_refresh(void)
 {
+    int x0, x1, y0, y1, x, y;
+
     if(!canvas.dirty)
     {
         return;
     }
 
-    display_prepare_gram_write();
-
-    int num_writes = canvas.width * canvas.height;
+    TRACE_START(start);
 
-    int i;
+    /* Only the dirty rectangle is written, mapped into display space */
 #ifdef INVERT_DISPLAY
-
-    for(i = num_writes; i > 0; i -= 2)
-    {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i - 1 ] >> 4);
+    x0 = canvas.width - 1 - canvas.dirty_x1;
+    x1 = canvas.width - 1 - canvas.dirty_x0;
+    y0 = canvas.height - 1 - canvas.dirty_y1;
+    y1 = canvas.height - 1 - canvas.dirty_y0;
 #else
+    x0 = canvas.dirty_x0;
+    x1 = canvas.dirty_x1;
+    y0 = canvas.dirty_y0;
+    y1 = canvas.dirty_y1;
+#endif
 
-    for(i = 0; i < num_writes; i += 2)
+    /* Widen to whole display columns */
+    x0 &= ~3;
+    x1 |= 3;
+
+    display_set_window(x0, x1, y0, y1);
+    display_prepare_gram_write();
+
+    for(y = y0; y <= y1; y++)
     {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i + 1 ] >> 4);
-#endif
-        display_write_ram(v);
+        for(x = x0; x <= x1; x += 2)
+        {
+            display_write_ram(display_pixels(x, y));
+        }
     }
 
-
     canvas.dirty = false;
+    TRACE_PHASE(TRACE_PHASE_LAYOUT, start);
 }
 
 /*
@@ -384,20 +441,7 @@ void display_hw_init(void)
     display_write_ram((uint8_t)0x00);
 
 
-    uint8_t row_start = START_ROW;
-    uint8_t row_end = row_start + 64 - 1;
-
-    /* Width is in units of 4 pixels/column (2 bytes at 4 bits/pixel) */
-    int width = (256 / 4);
-    uint8_t col_start = START_COL;
-    uint8_t col_end = col_start + width - 1;
-
-    display_write_reg((uint8_t)0x75);
-    display_write_ram(row_start);
-    display_write_ram(row_end);
-    display_write_reg((uint8_t)0x15);
-    display_write_ram(col_start);
-    display_write_ram(col_end);
+    display_set_window(0, KEEPKEY_DISPLAY_WIDTH - 1, 0, KEEPKEY_DISPLAY_HEIGHT - 1);
 
     /* Horizontal address increment */
     /* Disable colum address re-map */
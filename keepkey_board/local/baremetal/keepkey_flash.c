@@ -22,10 +22,149 @@
 #include <string.h>
 #include <stdint.h>
 
+#include <libopencm3/cm3/common.h>
+#include <libopencm3/cm3/dwt.h>
 #include <libopencm3/stm32/flash.h>
 
 #include "keepkey_flash.h"
 
+/* === Private Variables =================================================== */
+
+#if MSG_TRACE
+static FlashWriteStats write_stats;
+#endif
+
+/* === Private Functions =================================================== */
+
+/*
+ * flash_program_batch() - Program a run of same sized units into flash
+ *
+ * INPUT
+ *     - address: flash address, aligned to unit size
+ *     - data: source data, no alignment required
+ *     - count: number of units
+ *     - size: unit size in bytes (1, 2, 4 or 8)
+ * OUTPUT
+ *     none
+ *
+ */
+static void flash_program_batch(uint32_t address, const uint8_t *data, uint32_t count,
+                                uint32_t size)
+{
+    uint16_t half;
+    uint32_t i, word;
+    uint64_t dword;
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    flash_wait_for_last_operation();
+
+    /* Program size encoding is log2 of unit size */
+    FLASH_CR &= ~FLASH_CR_PROGRAM_X64;
+    FLASH_CR |= (__builtin_ctz(size) << 8);
+    FLASH_CR |= FLASH_CR_PG;
+
+    /*
+     * A write issued while the previous one is still in progress stalls the
+     * bus until it completes, so units are written back to back and error
+     * flags, which are sticky, are only checked once by the caller
+     */
+    for(i = 0; i < count; i++)
+    {
+        switch(size)
+        {
+            case sizeof(uint64_t):
+                memcpy(&dword, data, sizeof(dword));
+                MMIO64(address) = dword;
+                break;
+
+            case sizeof(uint32_t):
+                memcpy(&word, data, sizeof(word));
+                MMIO32(address) = word;
+                break;
+
+            case sizeof(uint16_t):
+                memcpy(&half, data, sizeof(half));
+                MMIO16(address) = half;
+                break;
+
+            default:
+                MMIO8(address) = *data;
+                break;
+        }
+
+        address += size;
+        data += size;
+    }
+
+    flash_wait_for_last_operation();
+    FLASH_CR &= ~FLASH_CR_PG;
+}
+
+/*
+ * flash_program_run() - Program data into flash at the largest parallelism
+ * allowed by the supply voltage range
+ *
+ * INPUT
+ *     - start: flash address
+ *     - data: source data
+ *     - len: length of source data
+ * OUTPUT
+ *     true/false status of write
+ *
+ */
+static bool flash_program_run(uint32_t start, const uint8_t *data, uint32_t len)
+{
+    uint32_t head, units, tail;
+
+#if MSG_TRACE
+    uint32_t begin;
+
+    dwt_enable_cycle_counter();
+    begin = dwt_read_cycle_counter();
+    write_stats.bytes = len;
+#endif
+
+    /* Don't let an error from an earlier operation fail this one */
+    flash_clear_status_flags();
+
+    /* Bytes up to the first unit aligned address */
+    head = (FLASH_PROGRAM_UNIT - start % FLASH_PROGRAM_UNIT) % FLASH_PROGRAM_UNIT;
+
+    if(head > len)
+    {
+        head = len;
+    }
+
+    flash_program_batch(start, data, head, sizeof(uint8_t));
+    start += head;
+    data += head;
+    len -= head;
+
+    /* Aligned units */
+    units = len / FLASH_PROGRAM_UNIT;
+    flash_program_batch(start, data, units, FLASH_PROGRAM_UNIT);
+    start += units * FLASH_PROGRAM_UNIT;
+    data += units * FLASH_PROGRAM_UNIT;
+
+    /* Remaining bytes smaller than a unit */
+    tail = len % FLASH_PROGRAM_UNIT;
+    flash_program_batch(start, data, tail, sizeof(uint8_t));
+
+#if MSG_TRACE
+    write_stats.head = head;
+    write_stats.units = units;
+    write_stats.tail = tail;
+    write_stats.unit_size = FLASH_PROGRAM_UNIT;
+    write_stats.cycles = dwt_read_cycle_counter() - begin;
+#endif
+
+    return(flash_chk_status());
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -113,7 +252,7 @@ void flash_erase(Allocation group)
 }
 
 /*
- * flash_write_word() - Flash write in word (32bit) size
+ * flash_write_word() - Flash write in word (32bit) or larger size
  *
  * INPUT
  *     - group: functional group
@@ -125,54 +264,12 @@ void flash_erase(Allocation group)
  */
 bool flash_write_word(Allocation group, uint32_t offset, uint32_t len, uint8_t *data)
 {
-    bool retval = true;
-	uint32_t start = flash_write_helper(group);
-    uint32_t data_word[1];
-    uint32_t i, align_cnt = 0;
-
-    start += offset ;
-
-    /* Byte writes for flash start address not long-word aligned */
-    if(start % sizeof(uint32_t)) {
-        align_cnt = sizeof(uint32_t) - start % sizeof(uint32_t);
-        flash_program(start, data, align_cnt);
-        if(flash_chk_status() == false) {
-            retval = false;
-            goto fww_exit;
-        }
-        /* Update new start address/data & len */
-        start += align_cnt;
-        data += align_cnt;
-        len -= align_cnt;
-    }
-
-    /* Long word writes */
-    for(i = 0 ; i < len/sizeof(uint32_t); i++)
-    {
-        memcpy(data_word, data, sizeof(uint32_t));
-	    flash_program_word(start, *data_word);
-	    // check flash status register for error condition
-        if(flash_chk_status() == false) {
-            retval = false;
-            goto fww_exit;
-        }
-        start += sizeof(uint32_t);
-        data += sizeof(uint32_t);
-    }
-
-    /* Byte write for last remaining bytes < longword */
-    if(len % sizeof(uint32_t)) {
-        flash_program(start, data, len % sizeof(uint32_t));
-        if(flash_chk_status() == false) {
-            retval = false;
-        }
-    }
-fww_exit:
-    return(retval);
+    return(flash_program_run(flash_write_helper(group) + offset, data, len));
 }
 
 /*
- * flash_write() - Flash write in byte size
+ * flash_write() - Flash write, unaligned head and tail bytes are written in
+ * byte size and the rest at full program parallelism
  *
  * INPUT : 
  *     - group: functional group
@@ -184,14 +281,23 @@ fww_exit:
  */
 bool flash_write(Allocation group, uint32_t offset, uint32_t len, uint8_t* data)
 {
-    bool retval = true;
-	uint32_t start = flash_write_helper(group);
-	flash_program(start + offset, data, len);
-    if(flash_chk_status() == false) {
-        retval = false;
-    }
-    return(retval);
+    return(flash_program_run(flash_write_helper(group) + offset, data, len));
+}
+
+#if MSG_TRACE
+/*
+ * flash_write_stats() - Get stats of the last flash write
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     pointer to write stats
+ */
+const FlashWriteStats *flash_write_stats(void)
+{
+    return(&write_stats);
 }
+#endif
 
 /*
  * is_mfg_mode() - Is device in manufacture mode
@@ -32,133 +32,95 @@
 /* === Private Variables =================================================== */
 
 static volatile uint32_t remaining_delay;
+static volatile uint32_t ticks = 0;
 static RunnableNode runnables[MAX_RUNNABLES];
-static RunnableQueue free_queue = {NULL, 0};
-static RunnableQueue active_queue = {NULL, 0};
+static RunnableNode *timer_wheel[TIMER_WHEEL_SIZE];
+static volatile uint32_t pending_events = 0;
 
 /* === Private Functions =================================================== */
 
 /*
- * runnable_queue_peek() - Get pointer to head node in task manager (queue)
+ * runnable_find() - Get the node that holds a task (callback function)
  *
  * INPUT
- *     - queue: head pointer to linklist (queue)
+ *     - callback: task function, NULL for a free node
  * OUTPUT
- *     head node in the queue
+ *     pointer to node or NULL if there is none
  */
-static RunnableNode *runnable_queue_peek(RunnableQueue *queue)
+static RunnableNode *runnable_find(Runnable callback)
 {
-    return(queue->head);
-}
-
-/*
- * runnable_queue_get() - Get the pointer to node that contains the
- * callback function (task)
- *
- * INPUT
- *     - queue: head pointer to linklist (queue)
- *     - callback: task function
- * OUTPUT
- *     pointer to a node containing the requested task function
- */
-static RunnableNode *runnable_queue_get(RunnableQueue *queue, Runnable callback)
-{
-    RunnableNode *current = queue->head;
-    RunnableNode *result = NULL;
+    int i;
 
-    /* check queue is empty */
-    if(current != NULL)
+    for(i = 0; i < MAX_RUNNABLES; i++)
     {
-        if(current->runnable == callback)
-        {
-            result = current;
-            queue->head = current->next;
-        }
-        else
+        if(runnables[ i ].runnable == callback)
         {
-            /* search through the linklist for node that contains the runnable
-               callback function */
-            RunnableNode *previous = current;
-            current = current->next;
-
-            while((current != NULL) && (result == NULL))
-            {
-                // Found the node!
-                if(current->runnable == callback)
-                {
-                    result = current;
-                    previous->next = current->next;
-                    result->next = NULL;
-                }
-
-                previous = current;
-                current = current->next;
-            }
+            return(&runnables[ i ]);
         }
     }
 
-    if(result != NULL)
-    {
-        queue->size -= 1;
-    }
-
-    return(result);
+    return(NULL);
 }
 
 /*
- * runnable_queue_push() - Push node to the task manger (queue)
+ * runnable_unlink() - Remove node from its timer wheel bucket. Must be called
+ * with interrupts disabled.
  *
  * INPUT
- *     - queue: head pointer to the queue
- *     - node: pointer to a new node to be added
+ *     - node: scheduled node
  * OUTPUT
  *     none
  */
-static void runnable_queue_push(RunnableQueue *queue, RunnableNode *node)
+static void runnable_unlink(RunnableNode *node)
 {
-    cm_disable_interrupts();
-
-    if(queue->head != NULL)
+    if(node->prev != NULL)
     {
-        node->next = queue->head;
+        node->prev->next = node->next;
     }
     else
     {
-        node->next = NULL;
+        timer_wheel[ node->expires & (TIMER_WHEEL_SIZE - 1) ] = node->next;
     }
 
-    queue->head = node;
-    queue->size += 1;
-    cm_enable_interrupts();
+    if(node->next != NULL)
+    {
+        node->next->prev = node->prev;
+    }
+
+    node->next = NULL;
+    node->prev = NULL;
 }
 
 /*
- * runnable_queue_pop() - Pop node from task manager (queue)
+ * runnable_schedule() - Add node to the timer wheel bucket of the tick it is
+ * due. Must be called with interrupts disabled.
  *
  * INPUT
- *     - queue: head pointer to task manager
+ *     - node: unscheduled node
+ *     - delay_ms: ticks from now, 0 runs on the next tick
  * OUTPUT
- *     pointer to an available node retrieved from the queue
+ *     none
  */
-static RunnableNode *runnable_queue_pop(RunnableQueue *queue)
+static void runnable_schedule(RunnableNode *node, uint32_t delay_ms)
 {
-    cm_disable_interrupts();
+    RunnableNode **bucket;
 
-    RunnableNode *runnable_node = queue->head;
+    node->expires = ticks + ((delay_ms != 0) ? delay_ms : 1);
+    bucket = &timer_wheel[ node->expires & (TIMER_WHEEL_SIZE - 1) ];
 
-    if(runnable_node != NULL)
+    node->prev = NULL;
+    node->next = *bucket;
+
+    if(*bucket != NULL)
     {
-        queue->head = runnable_node->next;
-        queue->size -= 1;
+        (*bucket)->prev = node;
     }
 
-    cm_enable_interrupts();
-
-    return(runnable_node);
+    *bucket = node;
 }
 
 /*
- * run_runnables() - Run task (callback function) located in task manager (queue)
+ * run_runnables() - Run tasks (callback functions) due on the current tick
  *
  * INPUT
  *     none
@@ -167,41 +129,89 @@ static RunnableNode *runnable_queue_pop(RunnableQueue *queue)
  */
 static void run_runnables(void)
 {
-    // Do timer function work.
-    RunnableNode *runnable_node = runnable_queue_peek(&active_queue);
+    RunnableNode **bucket = &timer_wheel[ ticks & (TIMER_WHEEL_SIZE - 1) ];
 
-    while(runnable_node != NULL)
+    while(1)
     {
-        RunnableNode *next = runnable_node->next;
+        bool masked = cm_mask_interrupts(true);
+        RunnableNode *runnable_node = *bucket;
+        Runnable runnable;
+        void *context;
+
+        /* Tasks due on a later turn of the wheel share the bucket */
+        while((runnable_node != NULL) && (runnable_node->expires != ticks))
+        {
+            runnable_node = runnable_node->next;
+        }
 
-        if(runnable_node->remaining != 0)
+        if(runnable_node == NULL)
         {
-            runnable_node->remaining -= 1;
+            cm_mask_interrupts(masked);
+            break;
         }
 
-        if(runnable_node->remaining == 0)
+        runnable = runnable_node->runnable;
+        context = runnable_node->context;
+        runnable_unlink(runnable_node);
+
+        /* Reschedule or free first so the task can post or remove itself */
+        if(runnable_node->repeating)
+        {
+            runnable_schedule(runnable_node, runnable_node->period);
+        }
+        else
         {
-            if(runnable_node->runnable != NULL)
-            {
-                runnable_node->runnable(runnable_node->context);
-            }
-
-            if(runnable_node->repeating)
-            {
-                runnable_node->remaining = runnable_node->period;
-            }
-            else
-            {
-                runnable_queue_push(
-                    &free_queue,
-                    runnable_queue_get(&active_queue, runnable_node->runnable));
-            }
+            runnable_node->runnable = NULL;
         }
 
-        runnable_node = next;
+        cm_mask_interrupts(masked);
+
+        runnable(context);
+        post_event(EVENT_TIMER);
     }
 }
 
+/*
+ * runnable_post() - Schedule task (callback function), replacing any pending
+ * run of the same task
+ *
+ * INPUT
+ *     - callback: task function
+ *     - context: pointer to task arguments
+ *     - period_ms: task repeat interval (period)
+ *     - delay_ms: delay befor task starts
+ *     - repeating: whether task repeats every period
+ * OUTPUT
+ *     none
+ */
+static void runnable_post(Runnable callback, void *context, uint32_t period_ms,
+                          uint32_t delay_ms, bool repeating)
+{
+    bool masked = cm_mask_interrupts(true);
+    RunnableNode *runnable_node = runnable_find(callback);
+
+    if(runnable_node != NULL)
+    {
+        runnable_unlink(runnable_node);
+    }
+    else
+    {
+        runnable_node = runnable_find(NULL);
+    }
+
+    /* Silently drop the task when all MAX_RUNNABLES nodes are in use */
+    if(runnable_node != NULL)
+    {
+        runnable_node->runnable     = callback;
+        runnable_node->context      = context;
+        runnable_node->period       = period_ms;
+        runnable_node->repeating    = repeating;
+        runnable_schedule(runnable_node, delay_ms);
+    }
+
+    cm_mask_interrupts(masked);
+}
+
 /* === Functions =========================================================== */
 
 /*
@@ -214,12 +224,7 @@ static void run_runnables(void)
  */
 void timer_init(void)
 {
-    int i;
-
-    for(i = 0; i < MAX_RUNNABLES; i++)
-    {
-        runnable_queue_push(&free_queue, &runnables[ i ]);
-    }
+    clear_runnables();
 
     // Set up the timer.
     timer_reset(TIM4);
@@ -284,14 +289,19 @@ void delay_ms(uint32_t ms)
 void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
                             uint32_t frequency_ms)
 {
+    uint32_t events = 0;
+
     remaining_delay = ms;
 
     while(remaining_delay > 0)
     {
-        if(remaining_delay % frequency_ms == 0)
+        /* Also call back as soon as USB needs servicing instead of on the next period */
+        if((remaining_delay % frequency_ms == 0) || (events & EVENT_USB))
         {
             (*callback_func)();
         }
+
+        events = wait_for_event(EVENT_TICK | EVENT_USB);
     }
 }
 
@@ -312,7 +322,9 @@ void tim4_isr(void)
         remaining_delay--;
     }
 
+    ticks++;
     run_runnables();
+    post_event(EVENT_TICK);
     timer_clear_flag(TIM4, TIM_SR_UIF);
 }
 
@@ -328,19 +340,7 @@ void tim4_isr(void)
  */
 void post_delayed(Runnable callback, void *context, uint32_t delay_ms)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
-
-    if(runnable_node == NULL)
-    {
-        runnable_node = runnable_queue_pop(&free_queue);
-    }
-
-    runnable_node->runnable     = callback;
-    runnable_node->context      = context;
-    runnable_node->remaining    = delay_ms;
-    runnable_node->period       = 0;
-    runnable_node->repeating    = false;
-    runnable_queue_push(&active_queue, runnable_node);
+    runnable_post(callback, context, 0, delay_ms, false);
 }
 
 /*
@@ -357,20 +357,7 @@ void post_delayed(Runnable callback, void *context, uint32_t delay_ms)
 void post_periodic(Runnable callback, void *context, uint32_t period_ms,
                    uint32_t delay_ms)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
-
-    if(runnable_node == NULL)
-    {
-        runnable_node = runnable_queue_pop(&free_queue);
-    }
-
-    runnable_node->runnable     = callback;
-    runnable_node->context      = context;
-    runnable_node->remaining    = delay_ms;
-    runnable_node->period       = period_ms;
-    runnable_node->repeating    = true;
-
-    runnable_queue_push(&active_queue, runnable_node);
+    runnable_post(callback, context, period_ms, delay_ms, true);
 }
 
 /*
@@ -383,16 +370,20 @@ void post_periodic(Runnable callback, void *context, uint32_t period_ms,
  */
 void remove_runnable(Runnable callback)
 {
-    RunnableNode *runnable_node = runnable_queue_get(&active_queue, callback);
+    bool masked = cm_mask_interrupts(true);
+    RunnableNode *runnable_node = runnable_find(callback);
 
-    if(runnable_node != NULL)
+    if((callback != NULL) && (runnable_node != NULL))
     {
-        runnable_queue_push(&free_queue, runnable_node);
+        runnable_unlink(runnable_node);
+        runnable_node->runnable = NULL;
     }
+
+    cm_mask_interrupts(masked);
 }
 
 /*
- * clear_runnables() - Reset free_queue and active_queue to initial state
+ * clear_runnables() - Remove all tasks from the task manager
  *
  * INPUT
  *     none
@@ -401,11 +392,71 @@ void remove_runnable(Runnable callback)
  */
 void clear_runnables(void)
 {
-    RunnableNode *runnable_node = runnable_queue_pop(&active_queue);
+    bool masked = cm_mask_interrupts(true);
+    int i;
+
+    for(i = 0; i < MAX_RUNNABLES; i++)
+    {
+        runnables[ i ].runnable = NULL;
+        runnables[ i ].next = NULL;
+        runnables[ i ].prev = NULL;
+    }
 
-    while(runnable_node != NULL)
+    for(i = 0; i < TIMER_WHEEL_SIZE; i++)
     {
-        runnable_queue_push(&free_queue, runnable_node);
-        runnable_node = runnable_queue_pop(&active_queue);
+        timer_wheel[ i ] = NULL;
     }
+
+    cm_mask_interrupts(masked);
+}
+
+/*
+ * post_event() - Flag events for loops waiting in wait_for_event(), safe to
+ * call from interrupt handlers
+ *
+ * INPUT
+ *     - events: EVENT_* flags to set
+ * OUTPUT
+ *     none
+ */
+void post_event(uint32_t events)
+{
+    bool masked = cm_mask_interrupts(true);
+
+    pending_events |= events;
+    cm_mask_interrupts(masked);
+}
+
+/*
+ * wait_for_event() - Sleep until one of the requested events is posted.  Must
+ * be called with interrupts enabled.
+ *
+ * INPUT
+ *     - events: EVENT_* flags to wait for
+ * OUTPUT
+ *     requested events that were posted, these are cleared
+ */
+uint32_t wait_for_event(uint32_t events)
+{
+    uint32_t posted;
+
+    /*
+     * Events are checked with interrupts disabled so one posted right before
+     * WFI is not missed. A pending interrupt still wakes the core and its
+     * handler runs once interrupts are enabled again.
+     */
+    cm_disable_interrupts();
+
+    while((pending_events & events) == 0)
+    {
+        __asm__ volatile("wfi");
+        cm_enable_interrupts();
+        cm_disable_interrupts();
+    }
+
+    posted = pending_events & events;
+    pending_events &= ~events;
+    cm_enable_interrupts();
+
+    return(posted);
 }
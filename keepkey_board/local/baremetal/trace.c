@@ -0,0 +1,224 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include <string.h>
+
+#include <libopencm3/cm3/dwt.h>
+
+#include "trace.h"
+
+#if MSG_TRACE
+
+/* === Private Variables =================================================== */
+
+static TraceStats message_stats[TRACE_MAX_MESSAGES];
+static uint32_t message_stats_count = 0;
+static TraceStats phase_stats[TRACE_PHASE_COUNT];
+
+/* === Private Functions =================================================== */
+
+/*
+ * trace_bucket() - Get histogram bucket for latency
+ *
+ * INPUT
+ *     - cycles: elapsed cycles
+ * OUTPUT
+ *     histogram bucket index
+ *
+ */
+static uint32_t trace_bucket(uint32_t cycles)
+{
+    uint32_t bucket = 0;
+
+    cycles >>= TRACE_BUCKET_SHIFT;
+
+    while(cycles && bucket < TRACE_HISTOGRAM_BUCKETS - 1)
+    {
+        cycles >>= 2;
+        bucket++;
+    }
+
+    return(bucket);
+}
+
+/*
+ * trace_record() - Add a latency sample to stats
+ *
+ * INPUT
+ *     - stats: stats to update
+ *     - start: cycle count at start of traced section
+ * OUTPUT
+ *     none
+ *
+ */
+static void trace_record(TraceStats *stats, uint32_t start)
+{
+    /* Unsigned subtraction handles a single wrap of the counter (~35s) */
+    uint32_t cycles = trace_now() - start;
+
+    if(stats->count == 0 || cycles < stats->min)
+    {
+        stats->min = cycles;
+    }
+
+    if(cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+
+    stats->count++;
+    stats->total += cycles;
+    stats->histogram[trace_bucket(cycles)]++;
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * trace_init() - Enable cycle counter and clear stats
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+void trace_init(void)
+{
+    dwt_enable_cycle_counter();
+    trace_reset();
+}
+
+/*
+ * trace_reset() - Clear all collected stats
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+void trace_reset(void)
+{
+    uint32_t i;
+
+    memset(message_stats, 0, sizeof(message_stats));
+    message_stats_count = 0;
+    memset(phase_stats, 0, sizeof(phase_stats));
+
+    for(i = 0; i < TRACE_PHASE_COUNT; i++)
+    {
+        phase_stats[i].id = i;
+    }
+}
+
+/*
+ * trace_now() - Get current cycle count
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     cycle count
+ *
+ */
+uint32_t trace_now(void)
+{
+    return(dwt_read_cycle_counter());
+}
+
+/*
+ * trace_message() - Record latency of a dispatched message
+ *
+ * INPUT
+ *     - msg_id: message id
+ *     - start: cycle count at start of dispatch
+ * OUTPUT
+ *     none
+ *
+ */
+void trace_message(uint32_t msg_id, uint32_t start)
+{
+    uint32_t i;
+
+    for(i = 0; i < message_stats_count; i++)
+    {
+        if(message_stats[i].id == msg_id)
+        {
+            trace_record(&message_stats[i], start);
+            return;
+        }
+    }
+
+    /* Message types beyond table capacity are not tracked */
+    if(message_stats_count < TRACE_MAX_MESSAGES)
+    {
+        message_stats[message_stats_count].id = msg_id;
+        trace_record(&message_stats[message_stats_count++], start);
+    }
+}
+
+/*
+ * trace_phase() - Record latency of a phase within a message
+ *
+ * INPUT
+ *     - phase: phase being traced
+ *     - start: cycle count at start of phase
+ * OUTPUT
+ *     none
+ *
+ */
+void trace_phase(TracePhase phase, uint32_t start)
+{
+    if(phase < TRACE_PHASE_COUNT)
+    {
+        trace_record(&phase_stats[phase], start);
+    }
+}
+
+/*
+ * trace_message_stats() - Get per message stats
+ *
+ * INPUT
+ *     - count: number of entries returned
+ * OUTPUT
+ *     pointer to message stats
+ *
+ */
+const TraceStats *trace_message_stats(uint32_t *count)
+{
+    *count = message_stats_count;
+    return(message_stats);
+}
+
+/*
+ * trace_phase_stats() - Get per phase stats
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     pointer to TRACE_PHASE_COUNT phase stats
+ *
+ */
+const TraceStats *trace_phase_stats(void)
+{
+    return(phase_stats);
+}
+
+#endif
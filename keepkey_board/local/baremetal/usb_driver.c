@@ -29,6 +29,7 @@
 #include <libopencm3/stm32/desig.h>
 #include <libopencm3/usb/hid.h>
 #include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/f2/nvic.h>
 
 #include "keepkey_board.h"
 
@@ -45,6 +46,26 @@ static usbd_device *usbd_dev = NULL;
  */
 static bool usb_configured = false;
 
+/*
+ * Outgoing reports waiting for their IN endpoint.  The endpoint FIFO holds
+ * the report in flight, the queue holds the ones after it, so a writer only
+ * waits when the queue itself is full.
+ */
+typedef struct
+{
+    uint8_t reports[USB_TX_QUEUE_DEPTH][USB_SEGMENT_SIZE];
+    uint32_t head;
+    uint32_t count;
+    uint8_t endpoint;
+} UsbTxQueue;
+
+static UsbTxQueue tx_queue = { .endpoint = ENDPOINT_ADDRESS_IN };
+static UsbTxQueue tx_bulk_queue = { .endpoint = ENDPOINT_ADDRESS_BULK_IN };
+#if DEBUG_LINK
+static UsbTxQueue tx_debug_queue = { .endpoint = ENDPOINT_ADDRESS_DEBUG_IN };
+#endif
+static UsbTxStats tx_stats;
+
 /* USB device descriptor */
 static const struct usb_device_descriptor dev_descr = {
 	.bLength = USB_DT_DEVICE_SIZE,
@@ -209,6 +230,35 @@ static const struct usb_interface_descriptor hid_iface_debug[] = {{
 }};
 #endif
 
+static const struct usb_endpoint_descriptor bulk_endpoints[] = {{
+	.bLength = USB_DT_ENDPOINT_SIZE,
+	.bDescriptorType = USB_DT_ENDPOINT,
+	.bEndpointAddress = ENDPOINT_ADDRESS_BULK_IN,
+	.bmAttributes = USB_ENDPOINT_ATTR_BULK,
+	.wMaxPacketSize = USB_SEGMENT_SIZE,
+	.bInterval = 0,
+}, {
+	.bLength = USB_DT_ENDPOINT_SIZE,
+	.bDescriptorType = USB_DT_ENDPOINT,
+	.bEndpointAddress = ENDPOINT_ADDRESS_BULK_OUT,
+	.bmAttributes = USB_ENDPOINT_ATTR_BULK,
+	.wMaxPacketSize = USB_SEGMENT_SIZE,
+	.bInterval = 0,
+}};
+
+static const struct usb_interface_descriptor bulk_iface[] = {{
+	.bLength = USB_DT_INTERFACE_SIZE,
+	.bDescriptorType = USB_DT_INTERFACE,
+	.bInterfaceNumber = USB_BULK_INTERFACE,
+	.bAlternateSetting = 0,
+	.bNumEndpoints = 2,
+	.bInterfaceClass = USB_CLASS_VENDOR,
+	.bInterfaceSubClass = 0,
+	.bInterfaceProtocol = 0,
+	.iInterface = 0,
+	.endpoint = bulk_endpoints,
+}};
+
 static const struct usb_interface ifaces[] = {{
 	.num_altsetting = 1,
 	.altsetting = hid_iface,
@@ -217,17 +267,16 @@ static const struct usb_interface ifaces[] = {{
 	.num_altsetting = 1,
 	.altsetting = hid_iface_debug,
 #endif
+}, {
+	.num_altsetting = 1,
+	.altsetting = bulk_iface,
 }};
 
 static const struct usb_config_descriptor config = {
 	.bLength = USB_DT_CONFIGURATION_SIZE,
 	.bDescriptorType = USB_DT_CONFIGURATION,
 	.wTotalLength = 0,
-#if DEBUG_LINK
-	.bNumInterfaces = 2,
-#else
-	.bNumInterfaces = 1,
-#endif
+	.bNumInterfaces = USB_BULK_INTERFACE + 1,
 	.bConfigurationValue = 1,
 	.iConfiguration = 0,
 	.bmAttributes = 0x80,
@@ -235,6 +284,27 @@ static const struct usb_config_descriptor config = {
 	.interface = ifaces,
 };
 
+/* Microsoft OS string descriptor (index 0xEE) */
+static const uint8_t ms_os_string_descriptor[] = {
+	0x12, USB_DT_STRING,
+	'M', 0, 'S', 0, 'F', 0, 'T', 0, '1', 0, '0', 0, '0', 0,
+	USB_MS_VENDOR_CODE, 0x00,
+};
+
+/* Extended compat ID descriptor, binds WinUSB to the bulk interface */
+static const uint8_t ms_compat_id_descriptor[] = {
+	0x28, 0x00, 0x00, 0x00,                     /* dwLength */
+	0x00, 0x01,                                 /* bcdVersion */
+	0x04, 0x00,                                 /* wIndex */
+	0x01,                                       /* bCount */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   /* reserved */
+	USB_BULK_INTERFACE,                         /* bFirstInterfaceNumber */
+	0x01,                                       /* reserved */
+	'W', 'I', 'N', 'U', 'S', 'B', 0x00, 0x00,   /* compatibleID */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* subCompatibleID */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,         /* reserved */
+};
+
 static const char *usb_strings[] = {
 	"KeepKey, LLC.",
 	"KeepKey",
@@ -292,11 +362,43 @@ static void hid_rx_callback(usbd_device *dev, uint8_t ep)
 
     if(rx && user_rx_callback)
     {
+        m.iface = USB_IFACE_HID;
         m.len = rx;
         user_rx_callback(&m);
     }
 }
 
+/*
+ * bulk_rx_callback() - Callback function to process received packet from USB
+ * host on the bulk interface
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - ep: unused
+ * OUTPUT
+ *     none
+ *
+ */
+static void bulk_rx_callback(usbd_device *dev, uint8_t ep)
+{
+    (void)ep;
+
+    /* Bulk packets carry no report marker, add it so framing is shared with HID */
+    UsbMessage m;
+    uint16_t rx = usbd_ep_read_packet(dev,
+                                      ENDPOINT_ADDRESS_BULK_OUT,
+                                      m.message + 1,
+                                      USB_SEGMENT_SIZE);
+
+    if(rx && user_rx_callback)
+    {
+        m.iface = USB_IFACE_BULK;
+        m.message[0] = '?';
+        m.len = rx + 1;
+        user_rx_callback(&m);
+    }
+}
+
 /*
  * hid_debug_rx_callback() - Callback function to process received packet from USB host on debug endpoint
  *
@@ -321,12 +423,152 @@ static void hid_debug_rx_callback(usbd_device *dev, uint8_t ep)
 
     if(rx && user_debug_rx_callback)
     {
+        m.iface = USB_IFACE_HID;
         m.len = rx;
         user_debug_rx_callback(&m);
     }
 }
 #endif
 
+/*
+ * usb_tx_queue_drain() - Hands queued reports to the endpoint for as long as
+ * it accepts them
+ *
+ * INPUT
+ *     - q: transmit queue
+ * OUTPUT
+ *     none
+ */
+static void usb_tx_queue_drain(UsbTxQueue *q)
+{
+    while(q->count > 0 && usbd_dev != NULL)
+    {
+        if(usbd_ep_write_packet(usbd_dev, q->endpoint, q->reports[q->head],
+                                USB_SEGMENT_SIZE) == 0)
+        {
+            break;
+        }
+
+        q->head = (q->head + 1) % USB_TX_QUEUE_DEPTH;
+        q->count--;
+        tx_stats.packets++;
+    }
+}
+
+/*
+ * usb_tx_queue_push() - Queue a report for transmission, sleeping until the
+ * endpoint makes room when the queue is full
+ *
+ * INPUT
+ *     - q: transmit queue
+ *     - report: USB_SEGMENT_SIZE byte report
+ * OUTPUT
+ *     none
+ */
+static void usb_tx_queue_push(UsbTxQueue *q, const uint8_t *report)
+{
+    if(q->count == USB_TX_QUEUE_DEPTH)
+    {
+        tx_stats.full_waits++;
+
+        /* The host frees the endpoint at most once per frame, sleep until the next tick */
+        while(q->count == USB_TX_QUEUE_DEPTH)
+        {
+            wait_for_event(EVENT_TICK);
+            usb_tx_queue_drain(q);
+        }
+    }
+
+    memcpy(q->reports[(q->head + q->count) % USB_TX_QUEUE_DEPTH], report, USB_SEGMENT_SIZE);
+    q->count++;
+
+    if(q->count > tx_stats.high_water)
+    {
+        tx_stats.high_water = q->count;
+    }
+
+    usb_tx_queue_drain(q);
+}
+
+/*
+ * usb_tx_callback() - Callback function for completed IN transfers, moves the
+ * next queued report into the endpoint
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - ep: endpoint that completed a transfer
+ * OUTPUT
+ *     none
+ */
+static void usb_tx_callback(usbd_device *dev, uint8_t ep)
+{
+    (void)dev;
+
+#if DEBUG_LINK
+    if((ep | 0x80) == ENDPOINT_ADDRESS_DEBUG_IN)
+    {
+        usb_tx_queue_drain(&tx_debug_queue);
+        return;
+    }
+#endif
+
+    if((ep | 0x80) == ENDPOINT_ADDRESS_BULK_IN)
+    {
+        usb_tx_queue_drain(&tx_bulk_queue);
+        return;
+    }
+
+    usb_tx_queue_drain(&tx_queue);
+}
+
+/*
+ * winusb_control_request() - Serve the Microsoft OS descriptors so Windows
+ * binds WinUSB to the bulk interface without a driver package
+ *
+ * INPUT
+ *     - dev: pointer to USB device handler
+ *     - req: setup request
+ *     - buf: reply buffer
+ *     - len: reply length, holds wLength on entry
+ *     - complete: unused
+ * OUTPUT
+ *     request handling status
+ */
+static int winusb_control_request(usbd_device *dev, struct usb_setup_data *req, uint8_t **buf,
+                                  uint16_t *len, void (**complete)(usbd_device *, struct usb_setup_data *))
+{
+    (void)complete;
+    (void)dev;
+
+    if(req->bmRequestType == (USB_REQ_TYPE_IN | USB_REQ_TYPE_STANDARD | USB_REQ_TYPE_DEVICE) &&
+            req->bRequest == USB_REQ_GET_DESCRIPTOR && req->wValue == ((USB_DT_STRING << 8) | 0xEE))
+    {
+        *buf = (uint8_t *)ms_os_string_descriptor;
+
+        if(*len > sizeof(ms_os_string_descriptor))
+        {
+            *len = sizeof(ms_os_string_descriptor);
+        }
+
+        return(USBD_REQ_HANDLED);
+    }
+
+    if(req->bmRequestType == (USB_REQ_TYPE_IN | USB_REQ_TYPE_VENDOR | USB_REQ_TYPE_DEVICE) &&
+            req->bRequest == USB_MS_VENDOR_CODE && req->wIndex == 0x0004)
+    {
+        *buf = (uint8_t *)ms_compat_id_descriptor;
+
+        if(*len > sizeof(ms_compat_id_descriptor))
+        {
+            *len = sizeof(ms_compat_id_descriptor);
+        }
+
+        return(USBD_REQ_HANDLED);
+    }
+
+    return(USBD_REQ_NEXT_CALLBACK);
+}
+
 /*
  * hid_set_config_callback() - Config USB IN/OUT endpoints and register callbacks
  *
@@ -340,12 +582,14 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
 {
 	(void)wValue;
 
-	usbd_ep_setup(dev, ENDPOINT_ADDRESS_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, 0);
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, usb_tx_callback);
 	usbd_ep_setup(dev, ENDPOINT_ADDRESS_OUT, USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_rx_callback);
 #if DEBUG_LINK
-	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, 0);
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_IN,  USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, usb_tx_callback);
 	usbd_ep_setup(dev, ENDPOINT_ADDRESS_DEBUG_OUT, USB_ENDPOINT_ATTR_INTERRUPT, USB_SEGMENT_SIZE, hid_debug_rx_callback);
 #endif
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_BULK_IN,  USB_ENDPOINT_ATTR_BULK, USB_SEGMENT_SIZE, usb_tx_callback);
+	usbd_ep_setup(dev, ENDPOINT_ADDRESS_BULK_OUT, USB_ENDPOINT_ATTR_BULK, USB_SEGMENT_SIZE, bulk_rx_callback);
 
 	usbd_register_control_callback(
 		dev,
@@ -353,6 +597,13 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
 		USB_REQ_TYPE_TYPE | USB_REQ_TYPE_RECIPIENT,
 		hid_control_request);
 
+	/* Set configuration drops every control callback, register it again */
+	usbd_register_control_callback(
+		dev,
+		USB_REQ_TYPE_DEVICE,
+		USB_REQ_TYPE_RECIPIENT,
+		winusb_control_request);
+
         usb_configured = true;
 }
 
@@ -362,23 +613,34 @@ static void hid_set_config_callback(usbd_device *dev, uint16_t wValue)
  * INPUT
  *     - message: pointer message buffer
  *     - len: length of message
- *     - endpoint: endpoint for transmission
+ *     - q: transmit queue of the endpoint
  * OUTPUT
  *     true/false
  */
-static bool usb_tx_helper(uint8_t *message, uint32_t len, uint8_t endpoint)
+static bool usb_tx_helper(uint8_t *message, uint32_t len, UsbTxQueue *q)
 {
     uint32_t pos = 1;
 
+    if(usbd_dev == NULL)
+    {
+        return(false);
+    }
+
     /* Chunk out message */
     while(pos < len)
     {
         uint8_t tmp_buffer[USB_SEGMENT_SIZE] = { 0 };
+        uint32_t n = len - pos;
+
+        if(n > USB_SEGMENT_SIZE - 1)
+        {
+            n = USB_SEGMENT_SIZE - 1;
+        }
 
         tmp_buffer[0] = '?';
-        memcpy(tmp_buffer + 1, message + pos, USB_SEGMENT_SIZE - 1);
+        memcpy(tmp_buffer + 1, message + pos, n);
 
-        while(usbd_ep_write_packet(usbd_dev, endpoint, tmp_buffer, USB_SEGMENT_SIZE) == 0) {};
+        usb_tx_queue_push(q, tmp_buffer);
 
         pos += USB_SEGMENT_SIZE - 1;
     }
@@ -417,6 +679,10 @@ bool usb_init(void)
                          sizeof(usbd_control_buffer));
         if(usbd_dev != NULL) {
             usbd_register_set_config_callback(usbd_dev, hid_set_config_callback);
+            usbd_register_control_callback(usbd_dev,
+                                           USB_REQ_TYPE_DEVICE,
+                                           USB_REQ_TYPE_RECIPIENT,
+                                           winusb_control_request);
         } else {
             /* error: unable init usbd_dev */
             ret_stat = false;
@@ -437,10 +703,85 @@ bool usb_init(void)
 void usb_poll(void)
 {
     usbd_poll(usbd_dev);
+
+    /* Let the core interrupt wake us again once there is more to handle */
+    nvic_enable_irq(NVIC_OTG_FS_IRQ);
+}
+
+/*
+ * otg_fs_isr() - USB core interrupt service routine.  The core is serviced by
+ * usb_poll() from the main loop so this only wakes it up.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void otg_fs_isr(void)
+{
+    /* Core interrupt stays asserted until polled, keep it off until then */
+    nvic_disable_irq(NVIC_OTG_FS_IRQ);
+    post_event(EVENT_USB);
+}
+
+/*
+ * usb_tx_pending() - Number of reports still queued for any endpoint
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     queued report count
+ */
+uint32_t usb_tx_pending(void)
+{
+#if DEBUG_LINK
+    return(tx_queue.count + tx_bulk_queue.count + tx_debug_queue.count);
+#else
+    return(tx_queue.count + tx_bulk_queue.count);
+#endif
 }
 
 /*
- * usb_tx() - Transmit USB message to host via normal endpoint
+ * usb_tx_flush() - Wait until every queued report has been handed to the
+ * endpoints
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_tx_flush(void)
+{
+    if(usbd_dev == NULL)
+    {
+        return;
+    }
+
+    while(usb_tx_pending() > 0)
+    {
+        usb_tx_queue_drain(&tx_queue);
+        usb_tx_queue_drain(&tx_bulk_queue);
+#if DEBUG_LINK
+        usb_tx_queue_drain(&tx_debug_queue);
+#endif
+    }
+}
+
+/*
+ * usb_tx_stats() - Get transmit queue statistics
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     pointer to transmit statistics
+ */
+const UsbTxStats *usb_tx_stats(void)
+{
+    return(&tx_stats);
+}
+
+/*
+ * usb_tx() - Transmit USB message to host via normal HID endpoint
  *
  * INPUT
  *     - message: pointer message buffer
@@ -450,7 +791,46 @@ void usb_poll(void)
  */
 bool usb_tx(uint8_t *message, uint32_t len)
 {
-    return usb_tx_helper(message, len, ENDPOINT_ADDRESS_IN);
+    return usb_tx_helper(message, len, &tx_queue);
+}
+
+/*
+ * usb_bulk_tx() - Transmit USB message to host via bulk endpoint.  Bulk
+ * packets carry no report marker, every byte of the packet is message data.
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ * OUTPUT
+ *     true/false
+ */
+bool usb_bulk_tx(uint8_t *message, uint32_t len)
+{
+    uint32_t pos = 0;
+
+    if(usbd_dev == NULL)
+    {
+        return(false);
+    }
+
+    while(pos < len)
+    {
+        uint8_t tmp_buffer[USB_SEGMENT_SIZE] = { 0 };
+        uint32_t n = len - pos;
+
+        if(n > USB_SEGMENT_SIZE)
+        {
+            n = USB_SEGMENT_SIZE;
+        }
+
+        memcpy(tmp_buffer, message + pos, n);
+
+        usb_tx_queue_push(&tx_bulk_queue, tmp_buffer);
+
+        pos += USB_SEGMENT_SIZE;
+    }
+
+    return(true);
 }
 
 /*
@@ -465,7 +845,7 @@ bool usb_tx(uint8_t *message, uint32_t len)
 #if DEBUG_LINK
 bool usb_debug_tx(uint8_t *message, uint32_t len)
 {
-    return usb_tx_helper(message, len, ENDPOINT_ADDRESS_DEBUG_IN);
+    return usb_tx_helper(message, len, &tx_debug_queue);
 }
 #endif
 
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include "timer.h"
+
+/*
+ * Host stand-in for the timer.  There are no interrupts to wait for, the
+ * emulator delivers packets before a loop would go to sleep.
+ */
+
+/* === Private Variables =================================================== */
+
+static uint32_t pending_events = 0;
+
+/* === Functions =========================================================== */
+
+/*
+ * post_event() - Flag events for loops waiting in wait_for_event()
+ *
+ * INPUT
+ *     - events: EVENT_* flags to post
+ * OUTPUT
+ *     none
+ */
+void post_event(uint32_t events)
+{
+    pending_events |= events;
+}
+
+/*
+ * wait_for_event() - Return the requested events without sleeping
+ *
+ * INPUT
+ *     - events: EVENT_* flags to wait for
+ * OUTPUT
+ *     requested events, all of them count as posted
+ */
+uint32_t wait_for_event(uint32_t events)
+{
+    pending_events &= ~events;
+    return(events);
+}
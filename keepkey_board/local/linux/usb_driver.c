@@ -0,0 +1,282 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "usb_driver.h"
+#include "usb_host.h"
+
+/*
+ * Host stand-in for the USB driver.  Packets are handed over by direct calls
+ * instead of endpoints, so the message stack can run off-device.
+ */
+
+/* === Private Variables =================================================== */
+
+static usb_rx_callback_t user_rx_callback = NULL;
+
+#if DEBUG_LINK
+static usb_rx_callback_t user_debug_rx_callback = NULL;
+#endif
+
+static usb_host_rx_callback_t host_rx_callback = NULL;
+static UsbTxStats tx_stats;
+
+/* === Private Functions =================================================== */
+
+/*
+ * usb_tx_helper() - Hand packets of a message to the host
+ *
+ * INPUT
+ *     - iface: interface the packets go out on
+ *     - message: pointer message buffer
+ *     - len: length of message
+ *     - marker: 1 if every packet starts with the '?' report marker
+ * OUTPUT
+ *     true/false
+ */
+static bool usb_tx_helper(UsbInterface iface, uint8_t *message, uint32_t len,
+                          uint32_t marker)
+{
+    uint32_t pos = marker;
+
+    /* Chunk out message */
+    while(pos < len)
+    {
+        uint8_t tmp_buffer[USB_SEGMENT_SIZE] = { 0 };
+        uint32_t n = len - pos;
+
+        if(n > USB_SEGMENT_SIZE - marker)
+        {
+            n = USB_SEGMENT_SIZE - marker;
+        }
+
+        tmp_buffer[0] = '?';
+        memcpy(tmp_buffer + marker, message + pos, n);
+
+        tx_stats.packets++;
+
+        if(host_rx_callback)
+        {
+            host_rx_callback(iface, tmp_buffer, USB_SEGMENT_SIZE);
+        }
+
+        pos += USB_SEGMENT_SIZE - marker;
+    }
+
+    return(true);
+}
+
+/* === Functions =========================================================== */
+
+/*
+ * usb_init() - Initialize USB registers and set callback functions
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     true/false status of USB init
+ */
+bool usb_init(void)
+{
+    return(true);
+}
+
+/*
+ * usb_poll() - Poll USB port for message
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_poll(void)
+{
+    /* Packets are delivered as soon as the host writes them */
+}
+
+/*
+ * get_usb_init_stat() - Get USB initialization status
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     USB device handler, there is none on the host
+ */
+usbd_device *get_usb_init_stat(void)
+{
+    return(NULL);
+}
+
+/*
+ * usb_tx_pending() - Number of reports still queued for any endpoint
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     queued report count
+ */
+uint32_t usb_tx_pending(void)
+{
+    return(0);
+}
+
+/*
+ * usb_tx_flush() - Wait until every queued report has been handed to the
+ * endpoints
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void usb_tx_flush(void)
+{
+}
+
+/*
+ * usb_tx_stats() - Get transmit queue statistics
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     pointer to statistics
+ */
+const UsbTxStats *usb_tx_stats(void)
+{
+    return(&tx_stats);
+}
+
+/*
+ * usb_tx() - Transmit USB message to host via normal HID endpoint
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ * OUTPUT
+ *     true/false
+ */
+bool usb_tx(uint8_t *message, uint32_t len)
+{
+    return(usb_tx_helper(USB_IFACE_HID, message, len, 1));
+}
+
+/*
+ * usb_bulk_tx() - Transmit USB message to host via bulk endpoint
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ * OUTPUT
+ *     true/false
+ */
+bool usb_bulk_tx(uint8_t *message, uint32_t len)
+{
+    return(usb_tx_helper(USB_IFACE_BULK, message, len, 0));
+}
+
+/*
+ * usb_debug_tx() - Transmit usb message to host via debug endpoint
+ *
+ * INPUT
+ *     - message: pointer message buffer
+ *     - len: length of message
+ * OUTPUT
+ *     true/false
+ */
+#if DEBUG_LINK
+bool usb_debug_tx(uint8_t *message, uint32_t len)
+{
+    return(usb_tx_helper(USB_IFACE_HID, message, len, 1));
+}
+#endif
+
+/*
+ * usb_set_rx_callback() - Setup USB receive callback function pointer
+ *
+ * INPUT
+ *     - callback: callback function
+ * OUTPUT
+ *     none
+ */
+void usb_set_rx_callback(usb_rx_callback_t callback)
+{
+    user_rx_callback = callback;
+}
+
+/*
+ * usb_set_debug_rx_callback() - Setup USB receive callback function pointer for debug link
+ *
+ * INPUT
+ *     - callback: callback function
+ * OUTPUT
+ *     none
+ */
+#if DEBUG_LINK
+void usb_set_debug_rx_callback(usb_rx_callback_t callback)
+{
+    user_debug_rx_callback = callback;
+}
+#endif
+
+/*
+ * usb_host_write() - Deliver a packet from the host as if it arrived on an
+ * OUT endpoint
+ *
+ * INPUT
+ *     - iface: interface the packet arrives on
+ *     - packet: HID report, or bulk packet without report marker
+ *     - len: length of packet
+ * OUTPUT
+ *     none
+ */
+void usb_host_write(UsbInterface iface, const uint8_t *packet, uint32_t len)
+{
+    UsbMessage m;
+    uint32_t offset = (iface == USB_IFACE_BULK) ? 1 : 0;
+
+    if(len == 0 || len > USB_SEGMENT_SIZE || !user_rx_callback)
+    {
+        return;
+    }
+
+    /* Bulk packets carry no report marker, add it like the bulk endpoint does */
+    m.message[0] = '?';
+    memcpy(m.message + offset, packet, len);
+    m.iface = iface;
+    m.len = len + offset;
+    user_rx_callback(&m);
+}
+
+/*
+ * usb_host_set_rx_callback() - Setup callback receiving packets the device
+ * sends to the host
+ *
+ * INPUT
+ *     - callback: callback function
+ * OUTPUT
+ *     none
+ */
+void usb_host_set_rx_callback(usb_host_rx_callback_t callback)
+{
+    host_rx_callback = callback;
+}
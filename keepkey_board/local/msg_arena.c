@@ -0,0 +1,124 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* === Includes ============================================================ */
+
+#include <assert.h>
+
+#include "msg_arena.h"
+
+/* === Defines ============================================================= */
+
+#define ARENA_ALIGN(x)          (((x) + 7) & ~7)
+#define ARENA_ALLOC_LIMIT       (MSG_ARENA_SIZE - MSG_RESP_SIZE)
+
+/* === Private Variables =================================================== */
+
+/*
+ * Memory for one request/response cycle.  The decoded message is allocated
+ * from the start and released when the next message is dispatched.  The
+ * response struct has its own region at the end so it can be
+ * built while the decoded message is still in use.
+ */
+static uint8_t arena[MSG_ARENA_SIZE] __attribute__((aligned(8)));
+static uint32_t arena_pos = 0;
+
+static uint32_t alloc_high_water = 0;
+static uint32_t response_high_water = 0;
+
+/* === Functions =========================================================== */
+
+/*
+ * msg_arena_reset() - Release all allocations for the previous message
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ *
+ */
+void msg_arena_reset(void)
+{
+    arena_pos = 0;
+}
+
+/*
+ * msg_arena_alloc() - Allocate memory that lives until the next message
+ *
+ * INPUT
+ *     - size: number of bytes
+ * OUTPUT
+ *     pointer to 8 byte aligned memory, NULL when arena is exhausted
+ *
+ */
+void *msg_arena_alloc(size_t size)
+{
+    uint32_t start = arena_pos;
+
+    if(size > ARENA_ALLOC_LIMIT - start)
+    {
+        return(NULL);
+    }
+
+    arena_pos = ARENA_ALIGN(start + size);
+
+    if(arena_pos > alloc_high_water)
+    {
+        alloc_high_water = arena_pos;
+    }
+
+    return(&arena[start]);
+}
+
+/*
+ * msg_arena_response() - Get the response region
+ *
+ * INPUT
+ *     - size: size of response struct
+ * OUTPUT
+ *     pointer to response region, shared by every response
+ *
+ */
+void *msg_arena_response(size_t size)
+{
+    assert(size <= MSG_RESP_SIZE);
+
+    if(size > response_high_water)
+    {
+        response_high_water = size;
+    }
+
+    return(&arena[ARENA_ALLOC_LIMIT]);
+}
+
+/*
+ * msg_arena_high_water() - Get the largest usage seen for each region
+ *
+ * INPUT
+ *     - alloc: bytes used by decoded messages
+ *     - response: bytes used by the response region
+ * OUTPUT
+ *     none
+ *
+ */
+void msg_arena_high_water(uint32_t *alloc, uint32_t *response)
+{
+    *alloc = alloc_high_water;
+    *response = response_high_water;
+}
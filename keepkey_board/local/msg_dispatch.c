@@ -25,10 +25,22 @@
 #include <nanopb.h>
 
 #include "usb_driver.h"
+#include "timer.h"
+#include "trace.h"
+#include "msg_arena.h"
 #include "msg_dispatch.h"
 
 /* === Private Variables =================================================== */
 
+/* HID report or bulk packet being filled by the outbound message stream */
+typedef struct
+{
+    uint8_t report[USB_SEGMENT_SIZE];
+    uint32_t pos;
+    uint32_t start;     /* 1 when the report begins with the '?' marker */
+    usb_tx_handler_t usb_tx_handler;
+} UsbReportStream;
+
 static const MessagesMap_t *MessagesMap = NULL;
 static size_t map_size = 0;
 static msg_failure_t msg_failure;
@@ -42,6 +54,9 @@ static bool msg_tiny_flag = false;
 static uint8_t msg_tiny[MSG_TINY_BFR_SZ];
 static uint16_t msg_tiny_id = MSG_TINY_TYPE_ERROR; /* Default to error type */
 
+/* Interface the message being handled arrived on, normal replies go back on it */
+static UsbInterface msg_reply_iface = USB_IFACE_HID;
+
 /* === Variables =========================================================== */
 
 /* Allow mapped messages to reset message stack.  This variable by itself doesn't
@@ -68,8 +83,11 @@ static const MessagesMap_t *message_map_entry(MessageMapType type,
 {
     const MessagesMap_t *m = MessagesMap;
 
+    assert(MessagesMap != NULL);
+
+    /* Unused slots are zero filled, so the id check rejects them */
     if(map_size > msg_id && m[msg_id].msg_id == msg_id && m[msg_id].type == type &&
-            m[msg_id].dir == dir)
+            m[msg_id].dir == dir && m[msg_id].fields != NULL)
     {
         return &m[msg_id];
     }
@@ -90,21 +108,72 @@ static const MessagesMap_t *message_map_entry(MessageMapType type,
 static const pb_field_t *message_fields(MessageMapType type, MessageType msg_id,
                                         MessageMapDirection dir)
 {
-    assert(MessagesMap != NULL);
+    const MessagesMap_t *entry = message_map_entry(type, msg_id, dir);
 
-    const MessagesMap_t *m = MessagesMap;
+    return(entry ? entry->fields : NULL);
+}
 
-    if(map_size > msg_id && m[msg_id].msg_id == msg_id && m[msg_id].type == type &&
-            m[msg_id].dir == dir)
+/*
+ * usb_report_write() - Output stream callback that packs bytes into HID reports
+ * and transmits each report as soon as it is full
+ *
+ * INPUT
+ *     - stream: output stream whose state is a UsbReportStream
+ *     - buf: bytes to write
+ *     - count: number of bytes to write
+ * OUTPUT
+ *     true/false whether bytes were written
+ */
+static bool usb_report_write(pb_ostream_t *stream, const uint8_t *buf, size_t count)
+{
+    UsbReportStream *rs = (UsbReportStream *)stream->state;
+
+    while(count > 0)
     {
-        return m[msg_id].fields;
+        size_t n = sizeof(rs->report) - rs->pos;
+
+        if(n > count)
+        {
+            n = count;
+        }
+
+        memcpy(rs->report + rs->pos, buf, n);
+        rs->pos += n;
+        buf += n;
+        count -= n;
+
+        if(rs->pos == sizeof(rs->report))
+        {
+            (*rs->usb_tx_handler)(rs->report, sizeof(rs->report));
+            rs->pos = rs->start;
+        }
     }
 
-    return NULL;
+    return(true);
 }
 
 /*
- * usb_write_pb() - Add usb frame header info to message buffer and perform usb transmission
+ * usb_report_flush() - Zero pads and transmits a partially filled report
+ *
+ * INPUT
+ *     - rs: report stream state
+ * OUTPUT
+ *     none
+ */
+static void usb_report_flush(UsbReportStream *rs)
+{
+    if(rs->pos > rs->start)
+    {
+        memset(rs->report + rs->pos, 0, sizeof(rs->report) - rs->pos);
+        (*rs->usb_tx_handler)(rs->report, sizeof(rs->report));
+        rs->pos = rs->start;
+    }
+}
+
+/*
+ * usb_write_pb() - Add usb frame header info to message and perform usb transmission,
+ * encoding straight into HID reports, or into full bulk packets when the
+ * message goes out the bulk interface
  *
  * INPUT
  *     - fields: protocol buffer
@@ -119,20 +188,37 @@ static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType
 {
     assert(fields != NULL);
 
-    TrezorFrameBuffer framebuf;
-    memset(&framebuf, 0, sizeof(framebuf));
-    framebuf.frame.usb_header.hid_type = '?';
-    framebuf.frame.header.pre1 = '#';
-    framebuf.frame.header.pre2 = '#';
-    framebuf.frame.header.id = __builtin_bswap16(id);
+    size_t len;
+    TrezorFrameHeaderFirst header;
+    UsbReportStream rs;
 
-    pb_ostream_t os = pb_ostream_from_buffer(framebuf.buffer,
-                      sizeof(framebuf.buffer));
+    /* Sizing pass so the frame header can go out ahead of the contents */
+    if(!pb_get_encoded_size(&len, fields, msg) || len > MAX_FRAME_SIZE)
+    {
+        return;
+    }
 
-    if(pb_encode(&os, fields, msg))
+    header.pre1 = '#';
+    header.pre2 = '#';
+    header.id = __builtin_bswap16(id);
+    header.len = __builtin_bswap32(len);
+
+    rs.report[0] = '?';
+    rs.start = (usb_tx_handler == &usb_bulk_tx) ? 0 : 1;
+    rs.pos = rs.start;
+    rs.usb_tx_handler = usb_tx_handler;
+
+    pb_ostream_t os =
+    {
+        .callback = usb_report_write,
+        .state = &rs,
+        .max_size = sizeof(header) + len,
+        .bytes_written = 0
+    };
+
+    if(pb_write(&os, (const uint8_t *)&header, sizeof(header)) && pb_encode(&os, fields, msg))
     {
-        framebuf.frame.header.len = __builtin_bswap32(os.bytes_written);
-        (*usb_tx_handler)((uint8_t *)&framebuf, sizeof(framebuf.frame) + os.bytes_written);
+        usb_report_flush(&rs);
     }
 }
 
@@ -167,9 +253,24 @@ static bool pb_parse(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
  */
 static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
 {
-    static uint8_t decode_buffer[MAX_DECODE_SIZE] __attribute__((aligned(4)));
+    uint8_t *decode_buffer;
+    bool parsed;
 
-    if(pb_parse(entry, msg, msg_size, decode_buffer))
+    /* Previous message is done with, its decoded struct can be reused */
+    msg_arena_reset();
+    decode_buffer = msg_arena_alloc(entry->decode_size);
+
+    if(!decode_buffer)
+    {
+        (*msg_failure)(FailureType_Failure_Other, "Message too large");
+        return;
+    }
+
+    TRACE_START(start);
+    parsed = pb_parse(entry, msg, msg_size, decode_buffer);
+    TRACE_PHASE(TRACE_PHASE_DECODE, start);
+
+    if(parsed)
     {
         if(entry->process_func)
         {
@@ -185,6 +286,8 @@ static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
         (*msg_failure)(FailureType_Failure_UnexpectedMessage,
                        "Could not parse protocol buffer message");
     }
+
+    TRACE_MESSAGE(entry->msg_id, start);
 }
 
 /*
@@ -200,6 +303,13 @@ static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size
  */
 static void tiny_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
 {
+    /* Only messages whose decoded struct fits can be handled while waiting */
+    if(entry->decode_size > sizeof(msg_tiny))
+    {
+        call_msg_failure_handler(FailureType_Failure_UnexpectedMessage, "Unexpected message");
+        return;
+    }
+
     bool status = pb_parse(entry, msg, msg_size, msg_tiny);
 
     if(status)
@@ -249,6 +359,7 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     static uint8_t content_buf[MAX_FRAME_SIZE];
     static uint32_t content_pos = 0, content_size = 0;
     static bool mid_frame = false;
+    static UsbInterface frame_iface = USB_IFACE_HID;
 
     const MessagesMap_t *entry;
     TrezorFrame *frame = (TrezorFrame *)(msg->message);
@@ -256,6 +367,7 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
 
     bool last_segment;
     uint8_t *contents;
+    uint8_t *parse_buf = content_buf;
 
     assert(msg != NULL);
 
@@ -271,6 +383,7 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         /* Byte swap in place. */
         last_frame_header.id = __builtin_bswap16(frame->header.id);
         last_frame_header.len = __builtin_bswap32(frame->header.len);
+        frame_iface = msg->iface;
 
         contents = frame->contents;
 
@@ -279,7 +392,7 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         content_size = content_pos;
 
     }
-    else if(mid_frame)
+    else if(mid_frame && msg->iface == frame_iface)
     {
         contents = frame_fragment->contents;
         content_pos += msg->len - 1;
@@ -304,6 +417,11 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
          */
         raw_dispatch(entry, contents, content_size, last_frame_header.len);
     }
+    else if(entry && last_segment && content_size == content_pos)
+    {
+        /* Whole message arrived in one packet, parse it where it lies */
+        parse_buf = contents;
+    }
     else if(entry)
     {
         /* Copy content to frame buffer */
@@ -321,6 +439,12 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         }
     }
 
+    if(last_segment && type == NORMAL_MSG)
+    {
+        /* Replies and failures go back on the interface the frame came in on */
+        msg_reply_iface = frame_iface;
+    }
+
     /*
      * Only parse and message map if all segments have been buffered
      * and this message type is parsable
@@ -329,15 +453,21 @@ static void usb_rx_helper(UsbMessage *msg, MessageMapType type)
     {
         (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unknown message");
     }
+    else if(last_segment && entry->dispatch != RAW && parse_buf == content_buf &&
+            last_frame_header.len > sizeof(content_buf))
+    {
+        /* Segments beyond the frame buffer were dropped */
+        (*msg_failure)(FailureType_Failure_Other, "Message too large");
+    }
     else if(last_segment && entry->dispatch != RAW)
     {
         if(msg_tiny_flag)
         {
-            tiny_dispatch(entry, content_buf, last_frame_header.len);
+            tiny_dispatch(entry, parse_buf, last_frame_header.len);
         }
         else
         {
-            dispatch(entry, content_buf, last_frame_header.len);
+            dispatch(entry, parse_buf, last_frame_header.len);
         }
     }
 
@@ -396,6 +526,8 @@ static MessageType tiny_msg_poll_and_buffer(bool block, uint8_t *buf)
         {
             break;
         }
+
+        wait_for_event(EVENT_USB);
     }
 
     msg_tiny_flag = false;
@@ -525,7 +657,8 @@ bool msg_write(MessageType msg_id, const void *msg)
     }
 
     /* add frame header to message and transmit out to usb */
-    usb_write_pb(fields, msg, msg_id, &usb_tx);
+    usb_write_pb(fields, msg, msg_id,
+                 msg_reply_iface == USB_IFACE_BULK ? &usb_bulk_tx : &usb_tx);
     return(true);
 }
 
@@ -25,14 +25,29 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/* === Defines ============================================================= */
+
+/* Bytes per canvas row */
+#define CANVAS_STRIDE(canvas)   ((canvas)->width / 2)
+
 /* === Typedefs ============================================================ */
 
+/*
+ * Buffer holds 4 bits per pixel in display ram order, left pixel of each
+ * pair in the high nibble
+ */
 typedef struct
 {
 	uint8_t* 	buffer;
 	int 		height;
 	int 		width;
 	bool 		dirty;
+
+	/* Dirty rectangle, inclusive, valid while dirty is set */
+	int 		dirty_x0;
+	int 		dirty_y0;
+	int 		dirty_x1;
+	int 		dirty_y1;
 } Canvas;
 
 #endif
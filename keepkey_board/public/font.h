@@ -24,9 +24,17 @@
 
 #include <stdint.h>
 
+/* === Defines ============================================================= */
+
+#define FONT_ROW_BYTES(img)     (((img)->width + 7) / 8)
+
 /* === Typedefs ============================================================ */
 
-/* Data pertaining to the image of a character */
+/*
+ * Data pertaining to the image of a character. Rows are packed one bit per
+ * pixel, most significant bit first, (width + 7) / 8 bytes per row. Set bits
+ * are drawn in the text color.
+ */
 typedef struct
 {
     const uint8_t  *data;
@@ -57,6 +65,7 @@ const Font *get_pin_font(void);
 const Font *get_title_font(void);
 const Font *get_body_font(void);
 
+int font_get_char_index(const Font *font, char c);
 const CharacterImage *font_get_char(const Font *font, char c);
 
 uint32_t font_height(const Font *font);
@@ -50,6 +50,10 @@
 
 #define CACHE_EXISTS        0xCA
 
+/* Persistent cache of account level (m/a'/b'/c') nodes */
+#define ACCOUNT_CACHE_SIZE  4
+#define ACCOUNT_CACHE_DEPTH 3
+
 /* Specify the length of the uuid binary string */
 #define STORAGE_UUID_LEN    12
 
@@ -74,12 +78,27 @@ typedef struct
     char uuid_str[STORAGE_UUID_STR_LEN];
 } Metadata;
 
+/* Account node cache entry */
+typedef struct
+{
+    uint8_t status;
+    uint32_t depth;
+    uint32_t address_n[ACCOUNT_CACHE_DEPTH];
+    uint32_t fingerprint;
+    uint8_t public_key[33];
+    uint8_t secret[64];     /* Chain code and private key, encrypted */
+    uint8_t mac[16];        /* Authenticates entry, also IV for secret */
+} AccountCache;
+
 /* Cache structure */
 typedef struct
 {
     /* Root node cache */
     uint8_t root_node_cache_status;
     HDNode root_node_cache;
+
+    /* Account node cache, added in storage version 2 */
+    AccountCache account_cache[ACCOUNT_CACHE_SIZE];
 } Cache;
 
 /* Config flash overlay structure.  */
@@ -26,6 +26,37 @@
 
 #include "memory.h"
 
+/* === Defines ============================================================= */
+
+/*
+ * Supply voltage range, sets the largest program parallelism the flash
+ * controller allows. x64 needs an external Vpp supply.
+ */
+#define FLASH_VOLTAGE_1V8           0       /* 1.8V - 2.1V, x8 */
+#define FLASH_VOLTAGE_2V1           1       /* 2.1V - 2.7V, x16 */
+#define FLASH_VOLTAGE_2V7           2       /* 2.7V - 3.6V, x32 */
+#define FLASH_VOLTAGE_VPP           3       /* 2.7V - 3.6V with Vpp, x64 */
+
+#ifndef FLASH_VOLTAGE_RANGE
+#define FLASH_VOLTAGE_RANGE         FLASH_VOLTAGE_2V7
+#endif
+
+#define FLASH_PROGRAM_UNIT          (1 << FLASH_VOLTAGE_RANGE)
+
+/* === Typedefs ============================================================ */
+
+#if MSG_TRACE
+typedef struct
+{
+    uint32_t bytes;         /* Total bytes written */
+    uint32_t head;          /* Unaligned leading bytes, written x8 */
+    uint32_t units;         /* Aligned units, written at full parallelism */
+    uint32_t tail;          /* Trailing bytes smaller than a unit, written x8 */
+    uint32_t unit_size;     /* Bytes per aligned unit */
+    uint32_t cycles;        /* Core cycles spent in the write */
+} FlashWriteStats;
+#endif
+
 /* === Functions =========================================================== */
 
 uint32_t flash_write_helper(Allocation group);
@@ -33,6 +64,9 @@ void flash_erase(Allocation group);
 void flash_erase_word(Allocation group);
 bool flash_write(Allocation group, uint32_t offset, uint32_t len, uint8_t* data);
 bool flash_write_word(Allocation group, uint32_t offset, uint32_t len, uint8_t* data);
+#if MSG_TRACE
+const FlashWriteStats *flash_write_stats(void);
+#endif
 bool flash_chk_status(void);
 bool is_mfg_mode(void);
 bool set_mfg_mode_off(void);
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef USB_HOST_H
+#define USB_HOST_H
+
+/* === Includes ============================================================ */
+
+#include <stdint.h>
+
+#include "usb_driver.h"
+
+/* === Typedefs ============================================================ */
+
+typedef void (*usb_host_rx_callback_t)(UsbInterface iface, const uint8_t *packet,
+                                       uint32_t len);
+
+/* === Functions =========================================================== */
+
+void usb_host_write(UsbInterface iface, const uint8_t *packet, uint32_t len);
+void usb_host_set_rx_callback(usb_host_rx_callback_t callback);
+
+#endif
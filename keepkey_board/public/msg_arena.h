@@ -0,0 +1,44 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MSG_ARENA_H
+#define MSG_ARENA_H
+
+/* === Includes ============================================================ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <interface.h>
+
+/* === Defines ============================================================= */
+
+/* Largest response struct (TxRequest) plus headroom */
+#define MSG_RESP_SIZE           (3 * 1024)
+
+#define MSG_ARENA_SIZE          (MAX_DECODE_SIZE + MSG_RESP_SIZE)
+
+/* === Functions =========================================================== */
+
+void msg_arena_reset(void);
+void *msg_arena_alloc(size_t size);
+void *msg_arena_response(size_t size);
+void msg_arena_high_water(uint32_t *alloc, uint32_t *response);
+
+#endif
@@ -32,11 +32,19 @@
 #define MSG_TINY_BFR_SZ     64
 #define MSG_TINY_TYPE_ERROR 0xFFFF
 
-#define MSG_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define MSG_OUT(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = OUT_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define RAW_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = RAW, [ID].process_func = PROCESS_FUNC,
-#define DEBUG_IN(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = IN_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
-#define DEBUG_OUT(ID, FIELDS, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = OUT_MSG, [ID].fields = FIELDS, [ID].dispatch = PARSABLE, [ID].process_func = PROCESS_FUNC,
+/*
+ * Message map entries are placed at their message id, so each map is a dense
+ * table indexed by id.  Entries carry the size of the decoded struct, and the
+ * build fails if an incoming message cannot fit in the decode buffer.
+ */
+#define MSG_DECODE_SIZE(NAME) \
+    (sizeof(NAME) + 0 * sizeof(char[(sizeof(NAME) <= MAX_DECODE_SIZE) ? 1 : -1]))
+
+#define MSG_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].decode_size = MSG_DECODE_SIZE(NAME), [ID].process_func = PROCESS_FUNC,
+#define MSG_OUT(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = OUT_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].decode_size = sizeof(NAME), [ID].process_func = PROCESS_FUNC,
+#define RAW_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = NORMAL_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = RAW, [ID].decode_size = 0, [ID].process_func = PROCESS_FUNC,
+#define DEBUG_IN(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = IN_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].decode_size = MSG_DECODE_SIZE(NAME), [ID].process_func = PROCESS_FUNC,
+#define DEBUG_OUT(ID, NAME, PROCESS_FUNC) [ID].msg_id = ID, [ID].type = DEBUG_MSG, [ID].dir = OUT_MSG, [ID].fields = NAME##_fields, [ID].dispatch = PARSABLE, [ID].decode_size = sizeof(NAME), [ID].process_func = PROCESS_FUNC,
 #define NO_PROCESS_FUNC 0
 
 /* === Typedefs ============================================================ */
@@ -79,6 +87,7 @@ typedef struct
     MessageMapType type;
     MessageMapDirection dir;
     MessageType msg_id;
+    uint32_t decode_size;
 } MessagesMap_t;
 
 /* === Functions =========================================================== */
@@ -29,7 +29,7 @@
 
 typedef struct
 {
-    const void *(*get_image_data)(uint8_t *);
+    const uint8_t *data;    /* RLE encoded pixels, read in place from flash */
     uint16_t    width;
     uint16_t    height;
 } Image;
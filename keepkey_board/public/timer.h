@@ -30,6 +30,13 @@
 #define ONE_SEC         1100    /* Count for 1 second  */
 #define HALF_SEC        500     /* Count for 0.5 second */
 #define MAX_RUNNABLES   3       /* Max number of queue for task manager */
+#define TIMER_WHEEL_SIZE 32     /* Buckets in timer wheel, power of two */
+
+/* Events that wake a loop sleeping in wait_for_event() */
+#define EVENT_TICK      (1 << 0)    /* Timer tick, every millisecond */
+#define EVENT_TIMER     (1 << 1)    /* A posted runnable ran */
+#define EVENT_BUTTON    (1 << 2)    /* Button pressed or released */
+#define EVENT_USB       (1 << 3)    /* USB core needs polling */
 
 /* === Typedefs ============================================================ */
 
@@ -37,22 +44,18 @@ typedef void (*callback_func_t)(void);
 typedef void (*Runnable)(void *context);
 typedef struct RunnableNode RunnableNode;
 
+/* Task scheduled in the timer wheel bucket of the tick it is due */
 struct RunnableNode
 {
-    uint32_t    remaining;
+    uint32_t    expires;
     Runnable    runnable;
     void        *context;
     uint32_t    period;
     bool        repeating;
     RunnableNode *next;
+    RunnableNode *prev;
 };
 
-typedef struct
-{
-    RunnableNode   *head;
-    int             size;
-} RunnableQueue;
-
 /* === Functions =========================================================== */
 
 void timer_init(void);
@@ -65,5 +68,7 @@ void post_periodic(Runnable runnable, void *context, uint32_t period_ms,
                    uint32_t delay_ms);
 void remove_runnable(Runnable runnable);
 void clear_runnables(void);
+void post_event(uint32_t events);
+uint32_t wait_for_event(uint32_t events);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2015 KeepKey LLC
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* === Includes ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Defines ============================================================= */
+
+#define TRACE_CYCLES_PER_US         120     /* Core clock set up by bootloader */
+#define TRACE_MAX_MESSAGES          16      /* Distinct message types tracked */
+#define TRACE_HISTOGRAM_BUCKETS     8
+
+/*
+ * Bucket 0 holds latencies below 2^TRACE_BUCKET_SHIFT cycles (~136us), each
+ * following bucket is 4x wider and the last one is open ended (>= ~0.5s)
+ */
+#define TRACE_BUCKET_SHIFT          14
+
+/* === Typedefs ============================================================ */
+
+typedef enum
+{
+    TRACE_PHASE_DECODE,
+    TRACE_PHASE_PIN,
+    TRACE_PHASE_DERIVE,
+    TRACE_PHASE_SERIALIZE,
+    TRACE_PHASE_SIGN,
+    TRACE_PHASE_LAYOUT,
+    TRACE_PHASE_COUNT
+} TracePhase;
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[TRACE_HISTOGRAM_BUCKETS];
+} TraceStats;
+
+/* === Functions =========================================================== */
+
+#if MSG_TRACE
+
+void trace_init(void);
+void trace_reset(void);
+uint32_t trace_now(void);
+void trace_message(uint32_t msg_id, uint32_t start);
+void trace_phase(TracePhase phase, uint32_t start);
+const TraceStats *trace_message_stats(uint32_t *count);
+const TraceStats *trace_phase_stats(void);
+
+#define TRACE_START(start)              uint32_t start = trace_now()
+#define TRACE_MESSAGE(msg_id, start)    trace_message(msg_id, start)
+#define TRACE_PHASE(phase, start)       trace_phase(phase, start)
+
+#else
+
+/* Tracing compiled out */
+#define trace_init()
+#define TRACE_START(start)
+#define TRACE_MESSAGE(msg_id, start)
+#define TRACE_PHASE(phase, start)
+
+#endif
+
+#endif
@@ -35,7 +35,8 @@
 
 #define USB_SEGMENT_SIZE 64
 #define MAX_NUM_USB_SEGMENTS 1
-#define MAX_MESSAGE_SIZE (USB_SEGMENT_SIZE * MAX_NUM_USB_SEGMENTS)
+/* One extra byte for the report marker put in front of bulk packets */
+#define MAX_MESSAGE_SIZE (USB_SEGMENT_SIZE * MAX_NUM_USB_SEGMENTS + 1)
 #define NUM_USB_STRINGS (sizeof(usb_strings) / sizeof(usb_strings[0]))
 
 /* USB endpoint */
@@ -47,20 +48,50 @@
 #define ENDPOINT_ADDRESS_DEBUG_OUT  (0x02)
 #endif
 
+#define ENDPOINT_ADDRESS_BULK_IN    (0x83)
+#define ENDPOINT_ADDRESS_BULK_OUT   (0x03)
+
+/* Vendor interface with bulk endpoints, bound to WinUSB on Windows */
+#if DEBUG_LINK
+#define USB_BULK_INTERFACE          2
+#else
+#define USB_BULK_INTERFACE          1
+#endif
+
+#define USB_MS_VENDOR_CODE          0x21
+
+/* HID reports that can be queued per IN endpoint while the host drains it */
+#define USB_TX_QUEUE_DEPTH 8
+
 /* Control buffer for use by the USB stack.  We just allocate the 
    space for it.  */
 #define USBD_CONTROL_BUFFER_SIZE 128
 
 /* === Typedefs ============================================================ */
 
+/* Interface a packet arrived on, replies go out the same way */
+typedef enum
+{
+    USB_IFACE_HID,
+    USB_IFACE_BULK
+} UsbInterface;
+
 typedef struct
 {
     uint32_t len;
+    UsbInterface iface;
     uint8_t message[MAX_MESSAGE_SIZE];
 } UsbMessage;
 
 typedef void (*usb_rx_callback_t)(UsbMessage* msg);
 
+typedef struct
+{
+    uint32_t packets;       /* reports handed to the endpoint */
+    uint32_t high_water;    /* most reports queued at once */
+    uint32_t full_waits;    /* times a writer had to wait for queue space */
+} UsbTxStats;
+
 /* === Functions =========================================================== */
 
 void usb_set_rx_callback(usb_rx_callback_t callback);
@@ -68,6 +99,10 @@ bool usb_init(void);
 void usb_poll(void);
 usbd_device *get_usb_init_stat(void);
 bool usb_tx(uint8_t *message, uint32_t len);
+bool usb_bulk_tx(uint8_t *message, uint32_t len);
+uint32_t usb_tx_pending(void);
+void usb_tx_flush(void);
+const UsbTxStats *usb_tx_stats(void);
 #if DEBUG_LINK
 bool usb_debug_tx(uint8_t *message, uint32_t len);
 void usb_set_debug_rx_callback(usb_rx_callback_t callback);
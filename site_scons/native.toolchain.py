@@ -0,0 +1,56 @@
+"""
+Host toolchain, used to build the emulator and the platform independent parts
+of the firmware it links against.
+"""
+from SCons.Script import *
+import os
+
+OPENCM3_ROOT = os.path.join(Dir('#').abspath, 'libopencm3')
+
+DEFS=['-DMAJOR_VERSION=1',
+      '-DMINOR_VERSION=1',
+      '-DPATCH_VERSION=0',
+      '-DPB_FIELD_16BIT=1']
+
+WARNS=['-Wall',
+       '-Wno-sequence-point',
+       '-Wextra',
+       '-Wformat',
+       '-Wimplicit-function-declaration',
+       '-Winit-self',
+       '-Wmultichar',
+       '-Wpointer-arith',
+       '-Wredundant-decls',
+       '-Wreturn-type',
+       '-Wshadow',
+       '-Wsign-compare',
+       '-Wstrict-prototypes',
+       '-Wundef',
+       '-Wuninitialized',
+       # Message map handlers are stored as one generic function pointer type
+       '-Wno-cast-function-type']
+
+# No -Werror: host compilers are newer than the pinned ARM toolchain and warn
+# on the third party crypto code that the firmware build accepts
+
+def load_toolchain():
+    env = DefaultEnvironment()
+
+    env['LINKFLAGS'] = []
+
+    env['CCFLAGS'] = [
+            # USB and flash types come from the libopencm3 headers
+            '-I'+OPENCM3_ROOT+'/include',
+            ]
+
+    env['CCFLAGS'] = env['CCFLAGS'] + DEFS + WARNS
+
+    env['CFLAGS'] = ['-std=gnu99' ]
+
+    #
+    # Debug
+    #
+    if int(ARGUMENTS.get('debug', 0)):
+        env['CCFLAGS'] += ['-g', '-O0', '-DDEBUG_ON']
+    else:
+        env['CCFLAGS'] += ['-O2', '-g']
@@ -170,7 +170,9 @@ def init_project(env, deps=None, libs=None, project_defines=None):
     flavor_map = get_flavors()
 
     linkflags = []
-    if project_name == 'bootstrap':
+    if build_os != 'baremetal':
+        linkflags = env['LINKFLAGS']
+    elif project_name == 'bootstrap':
         linkflags = env['LINKFLAGS'] + ['-T' + Dir('#').abspath + '/memory_bootstrap.ld']
     elif project_name == 'bootloader':
         linkflags = env['LINKFLAGS'] + ['-T' + Dir('#').abspath + '/memory_bootloader.ld']
@@ -290,11 +292,9 @@ def init_product():
         project_deps.append(project)
 
     target = ARGUMENTS.get('target', 'native')
-    if target != 'native':
-        toolchain_dir = os.path.join(Dir('#').abspath, 'site_scons')    
-        toolchain_name = ARGUMENTS.get('target')
-        assert toolchains.load_toolchain(toolchain_dir, toolchain_name) == True,\
-            "Toolchain '%s' not found." % toolchain_name
+    toolchain_dir = os.path.join(Dir('#').abspath, 'site_scons')    
+    assert toolchains.load_toolchain(toolchain_dir, target) == True,\
+        "Toolchain '%s' not found." % target
 
     env = DefaultEnvironment()
     